@@ -0,0 +1,244 @@
+#include "bench.hpp"
+#include "bench_enums.hpp"
+
+#include "trlc/enum.hpp"
+#include "trlc/enum/batch.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TRLC_ENUM(HttpHeaders,
+          ACCEPT,
+          ACCEPT_CHARSET,
+          ACCEPT_ENCODING,
+          ACCEPT_LANGUAGE,
+          AUTHORIZATION,
+          CACHE_CONTROL,
+          CONNECTION,
+          CONTENT_ENCODING,
+          CONTENT_LENGTH,
+          CONTENT_TYPE,
+          COOKIE,
+          DATE,
+          ETAG,
+          EXPECT,
+          HOST,
+          IF_MATCH,
+          IF_MODIFIED_SINCE,
+          IF_NONE_MATCH,
+          LOCATION,
+          ORIGIN,
+          PRAGMA,
+          RANGE,
+          REFERER,
+          SERVER,
+          SET_COOKIE,
+          TE,
+          TRAILER,
+          UPGRADE,
+          USER_AGENT,
+          VARY,
+          VIA,
+          WARNING)
+
+namespace
+{
+
+constexpr std::size_t INPUT_COUNT{1024}; ///< Number of inputs cycled through by lookup benchmarks, a power of two.
+
+/**
+ * @brief Inputs of the lookup benchmarks of one enum, in a shuffled order.
+ */
+template<class Holder>
+struct Inputs
+{
+    std::vector<typename Holder::value_type> hit_values{};
+    std::vector<typename Holder::value_type> miss_values{};
+    std::vector<std::string> hit_names{};
+    std::vector<std::string> miss_names{};
+
+    Inputs()
+    {
+        std::uint64_t state{0x2545F4914F6CDD1DULL};
+        for (std::size_t input{0}; input < INPUT_COUNT; ++input)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            const auto& item{Holder::m_array[state % Holder::size()]};
+            hit_values.push_back(item.value());
+            hit_names.emplace_back(item.name());
+
+            // Values next to an enumerator and names sharing a prefix or the length of one.
+            auto miss_value{item.value()};
+            while (Holder::fromValue(miss_value))
+            {
+                ++miss_value;
+            }
+            miss_values.push_back(miss_value);
+            std::string miss_name{item.name()};
+            miss_name.back() = miss_name.back() == 'X' ? 'Y' : 'X';
+            miss_names.push_back(miss_name);
+        }
+    }
+};
+
+template<class Holder, class Policy>
+void benchValueSearch(std::string_view group, std::string_view policy, const Inputs<Holder>& inputs)
+{
+    const auto* hits{inputs.hit_values.data()};
+    const auto* misses{inputs.miss_values.data()};
+    trlc::bench::run(group, std::string{"fromValue/"} + std::string{policy} + "/hit", [&](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Policy::template search<Holder>(hits[iteration % INPUT_COUNT])); });
+    trlc::bench::run(group, std::string{"fromValue/"} + std::string{policy} + "/miss", [&](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Policy::template search<Holder>(misses[iteration % INPUT_COUNT])); });
+}
+
+template<class Holder, class Policy>
+void benchNameSearch(std::string_view group, std::string_view policy, const Inputs<Holder>& inputs)
+{
+    std::vector<std::string_view> hits(inputs.hit_names.begin(), inputs.hit_names.end());
+    std::vector<std::string_view> misses(inputs.miss_names.begin(), inputs.miss_names.end());
+    trlc::bench::run(group, std::string{"fromString/"} + std::string{policy} + "/hit", [&](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Policy::template search<Holder>(hits[iteration % INPUT_COUNT])); });
+    trlc::bench::run(group, std::string{"fromString/"} + std::string{policy} + "/miss", [&](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Policy::template search<Holder>(misses[iteration % INPUT_COUNT])); });
+}
+
+template<class Holder>
+void benchBatch(std::string_view group, const Inputs<Holder>& inputs)
+{
+    static std::array<typename Holder::enum_type, INPUT_COUNT> out{};
+    const auto* hits{inputs.hit_values.data()};
+    trlc::bench::run(group, "fromValue/loop/1024", [&](std::size_t)
+                     {
+                         for (std::size_t input{0}; input < INPUT_COUNT; ++input)
+                         {
+                             out[input] = *Holder::fromValue(hits[input]);
+                         }
+                         trlc::bench::doNotOptimize(out);
+                     });
+    trlc::bench::run(group, "fromValues/1024", [&](std::size_t)
+                     {
+                         trlc::bench::doNotOptimize(Holder::fromValues(hits, INPUT_COUNT, out.data()));
+                     });
+
+    std::vector<std::string_view> names(inputs.hit_names.begin(), inputs.hit_names.end());
+    static std::array<std::uint64_t, INPUT_COUNT / 64> errors{};
+    trlc::bench::run(group, "fromStrings/1024", [&](std::size_t)
+                     {
+                         trlc::bench::doNotOptimize(Holder::fromStrings(names.data(), INPUT_COUNT, out.data(), errors.data()));
+                     });
+}
+
+/**
+ * @brief Runs every benchmark on one enum.
+ */
+template<class Holder>
+void benchEnum(std::string_view group)
+{
+    using namespace trlc::policy;
+    const Inputs<Holder> inputs{};
+
+    benchValueSearch<Holder, LinearSearchPolicy>(group, "Linear", inputs);
+    benchValueSearch<Holder, BinarySearchPolicy>(group, "Binary", inputs);
+    benchValueSearch<Holder, EytzingerSearchPolicy>(group, "Eytzinger", inputs);
+    benchValueSearch<Holder, DenseTableSearchPolicy>(group, "DenseTable", inputs);
+    benchValueSearch<Holder, AutoSearchPolicy>(group, "Auto", inputs);
+
+    benchBatch<Holder>(group, inputs);
+
+    trlc::bench::run(group, "fromChars/hit", [&](std::size_t iteration)
+                     {
+                         const auto& name{inputs.hit_names[iteration % INPUT_COUNT]};
+                         trlc::bench::doNotOptimize(Holder::fromChars(name.data(), name.data() + name.size()));
+                     });
+    trlc::bench::run(group, "fromChars/miss", [&](std::size_t iteration)
+                     {
+                         const auto& name{inputs.miss_names[iteration % INPUT_COUNT]};
+                         trlc::bench::doNotOptimize(Holder::fromChars(name.data(), name.data() + name.size()));
+                     });
+
+    benchNameSearch<Holder, CaseSensitiveStringSearchPolicy>(group, "CaseSensitive", inputs);
+    benchNameSearch<Holder, CaseInsensitiveStringSearchPolicy>(group, "CaseInsensitive", inputs);
+    benchNameSearch<Holder, LengthBucketedStringSearchPolicy>(group, "LengthBucketed", inputs);
+    benchNameSearch<Holder, PerfectHashStringSearchPolicy>(group, "PerfectHash", inputs);
+    benchNameSearch<Holder, CaseInsensitivePerfectHashStringSearchPolicy>(group, "CaseInsensitivePerfectHash", inputs);
+    benchNameSearch<Holder, AutoSearchPolicy>(group, "Auto", inputs);
+
+    trlc::bench::run(group, "iterate", [](std::size_t)
+                     {
+                         for (auto item : Holder::iterator)
+                         {
+                             trlc::bench::doNotOptimize(item);
+                         }
+                     });
+    trlc::bench::run(group, "Enum::dump", [](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Holder::m_array[iteration % Holder::size()].dump()); });
+    trlc::bench::run(group, "Enum::dumpTo", [](std::size_t iteration)
+                     {
+                         static char buffer[256];
+                         trlc::bench::doNotOptimize(Holder::m_array[iteration % Holder::size()].dumpTo(std::begin(buffer), std::end(buffer)).ptr);
+                     });
+    trlc::bench::run(group, "dump", [](std::size_t)
+                     { trlc::bench::doNotOptimize(Holder::dump()); });
+    trlc::bench::run(group, "dumpTo", [](std::size_t)
+                     {
+                         static char buffer[Holder::dumpSize()];
+                         trlc::bench::doNotOptimize(Holder::dumpTo(std::begin(buffer), std::end(buffer)).ptr);
+                     });
+}
+
+constexpr std::array<std::string_view, 8> CASE_INSENSITIVE_HITS{
+    "accept", "Content_Type", "USER_AGENT", "if_modified_since", "Host", "set_cookie", "Cache_Control", "te"};
+
+constexpr std::array<std::string_view, 8> CASE_INSENSITIVE_MISSES{
+    "accepts", "Content-Type", "X_REQUEST_ID", "if_modified_after", "Hots", "dnt", "Forwarded", "tk"};
+
+template<class Policy, std::size_t N>
+void benchCaseInsensitiveSearch(std::string_view name, const std::array<std::string_view, N>& inputs)
+{
+    trlc::bench::run("case_insensitive_search", name, [&](std::size_t iteration)
+                     { trlc::bench::doNotOptimize(Policy::template search<HttpHeaders>(inputs[iteration % N])); });
+}
+
+/**
+ * @brief Compares the case-insensitive name policies on mixed case HTTP header names.
+ */
+void benchCaseInsensitiveSearch()
+{
+    using trlc::policy::CaseInsensitivePerfectHashStringSearchPolicy;
+    using trlc::policy::CaseInsensitiveStringSearchPolicy;
+
+    benchCaseInsensitiveSearch<CaseInsensitiveStringSearchPolicy>("CaseInsensitive/hit", CASE_INSENSITIVE_HITS);
+    benchCaseInsensitiveSearch<CaseInsensitivePerfectHashStringSearchPolicy>("CaseInsensitivePerfectHash/hit", CASE_INSENSITIVE_HITS);
+    benchCaseInsensitiveSearch<CaseInsensitiveStringSearchPolicy>("CaseInsensitive/miss", CASE_INSENSITIVE_MISSES);
+    benchCaseInsensitiveSearch<CaseInsensitivePerfectHashStringSearchPolicy>("CaseInsensitivePerfectHash/miss", CASE_INSENSITIVE_MISSES);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        trlc::bench::filter() = argv[1];
+    }
+
+    trlc::bench::printHeader();
+    benchEnum<Dense4>("dense_4");
+    benchEnum<Sparse4>("sparse_4");
+    benchEnum<Dense16>("dense_16");
+    benchEnum<Sparse16>("sparse_16");
+    benchEnum<Dense64>("dense_64");
+    benchEnum<Sparse64>("sparse_64");
+    benchEnum<Dense256>("dense_256");
+    benchEnum<Sparse256>("sparse_256");
+    benchCaseInsensitiveSearch();
+    return 0;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace trlc
+{
+namespace bench
+{
+
+/**
+ * @brief Prevents the compiler from optimizing away the computation of a value.
+ *
+ * @param value The value that must be materialized.
+ */
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* sink{reinterpret_cast<const volatile char*>(&value)};
+    static_cast<void>(*sink);
+#endif
+}
+
+/**
+ * @brief The result of a measurement.
+ */
+struct Result
+{
+    double ns_per_op{};       ///< Best observed time of one operation in nanoseconds.
+    std::size_t iterations{}; ///< Number of operations per repetition.
+};
+
+/**
+ * @brief Measures the time of one call to a function.
+ *
+ * The number of iterations is doubled until a repetition lasts at least MIN_DURATION,
+ * then the best of REPETITIONS repetitions is kept.
+ *
+ * @param function The function to measure, called with the iteration index.
+ * @return The measurement result.
+ */
+template<class Function>
+Result measure(Function&& function)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr auto MIN_DURATION{std::chrono::milliseconds(20)};
+    constexpr std::size_t MAX_ITERATIONS{std::size_t{1} << 30};
+    constexpr int REPETITIONS{5};
+
+    auto run = [&](std::size_t iterations)
+    {
+        const auto start{clock::now()};
+        for (std::size_t iteration{0}; iteration < iterations; ++iteration)
+        {
+            function(iteration);
+        }
+        return clock::now() - start;
+    };
+
+    std::size_t iterations{1};
+    while (run(iterations) < MIN_DURATION && iterations < MAX_ITERATIONS)
+    {
+        iterations *= 2;
+    }
+
+    double best{std::numeric_limits<double>::max()};
+    for (int repetition{0}; repetition < REPETITIONS; ++repetition)
+    {
+        const std::chrono::duration<double, std::nano> elapsed{run(iterations)};
+        best = std::min(best, elapsed.count() / static_cast<double>(iterations));
+    }
+    return Result{best, iterations};
+}
+
+/**
+ * @brief Returns the benchmark filter, benchmarks whose "group/name" does not contain it are skipped.
+ */
+inline std::string& filter()
+{
+    static std::string value{};
+    return value;
+}
+
+/**
+ * @brief Prints the header of the result table.
+ */
+inline void printHeader()
+{
+    std::printf("%-28s %-48s %12s %12s\n", "group", "benchmark", "ns/op", "iterations");
+}
+
+/**
+ * @brief Prints one row of the result table.
+ *
+ * @param group The benchmark group.
+ * @param name The benchmark name.
+ * @param result The measurement result.
+ */
+inline void printResult(std::string_view group, std::string_view name, const Result& result)
+{
+    std::printf("%-28.*s %-48.*s %12.2f %12zu\n",
+                static_cast<int>(group.size()), group.data(),
+                static_cast<int>(name.size()), name.data(),
+                result.ns_per_op, result.iterations);
+}
+
+/**
+ * @brief Measures a function and prints the result, unless the benchmark is filtered out.
+ *
+ * @param group The benchmark group.
+ * @param name The benchmark name.
+ * @param function The function to measure, called with the iteration index.
+ */
+template<class Function>
+void run(std::string_view group, std::string_view name, Function&& function)
+{
+    std::string full_name{group};
+    full_name += "/";
+    full_name += name;
+    if (full_name.find(filter()) == std::string::npos)
+    {
+        return;
+    }
+    printResult(group, name, measure(function));
+}
+
+} // namespace bench
+} // namespace trlc
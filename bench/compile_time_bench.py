@@ -0,0 +1,178 @@
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+try:
+    import resource
+except ImportError:  # Not available on Windows, the peak memory is then not reported.
+    resource = None
+
+SIZES = (8, 64, 256, 1024)
+
+
+def sparse_value(index):
+    # Distinct values spread over [-500000, 500002], in a shuffled declaration order.
+    return (index * 2654435761) % 1000003 - 500000
+
+
+def generate_source(size, fields):
+    """Returns a translation unit declaring one enum of size enumerators and looking it up."""
+    lines = ['#include "trlc/enum.hpp"', ""]
+    if size == 0:
+        return "\n".join(lines) + "\n"
+
+    name = f"{'Field' if fields else 'Plain'}{size}"
+    lines.append(f"TRLC_ENUM({name},")
+    for index in range(size):
+        enumerator = f"ENUMERATOR_{index}"
+        if fields:
+            enumerator += f" = TRLC_FIELD(value = {sparse_value(index)}, desc = \"Enumerator {index}.\")"
+        separator = ")" if index == size - 1 else ","
+        lines.append(f"          {enumerator}{separator}")
+    lines += [
+        "",
+        f"std::optional<{name}::enum_type> fromValue({name}::value_type value)",
+        "{",
+        f"    return {name}::fromValue(value);",
+        "}",
+        "",
+        f"std::optional<{name}::enum_type> fromString(std::string_view name)",
+        "{",
+        f"    return {name}::fromString(name);",
+        "}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def parse_gcc_report(report):
+    """Returns the front-end and constexpr evaluation wall times of a GCC -ftime-report."""
+
+    def wall(phase):
+        match = re.search(rf"^\s*{re.escape(phase)}\s*:\s*\S+\s*\(\s*\d+%\)\s*\S+\s*\(\s*\d+%\)\s*(\S+)", report, re.MULTILINE)
+        return float(match.group(1)) if match else None
+
+    parsing = wall("phase parsing")
+    deferred = wall("phase lang. deferred")
+    front_end = None if parsing is None else parsing + (deferred or 0.0)
+    return front_end, wall("constant expression evaluation")
+
+
+def parse_clang_trace(trace_file):
+    """Returns the front-end time of a Clang -ftime-trace file."""
+    with open(trace_file) as f:
+        events = json.load(f).get("traceEvents", [])
+    for event in events:
+        if event.get("name") == "Total Frontend":
+            return event["dur"] / 1e6, None
+    return None, None
+
+
+def compile_once(command, compiler_id, object_file):
+    """Compiles once and returns the wall time, the front-end and constexpr times and the peak memory in MiB."""
+    if compiler_id == "GNU":
+        command = command + ["-ftime-report"]
+    elif compiler_id in ("Clang", "AppleClang"):
+        command = command + ["-ftime-trace"]
+
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+    stdout, stderr = process.communicate()
+    wall = time.perf_counter() - start
+    # The rusage of the waited children holds the largest resident set of any of them,
+    # in KiB on Linux and in bytes on macOS.
+    peak_memory = None
+    if resource is not None:
+        peak_memory = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss / (1024 * 1024 if sys.platform == "darwin" else 1024)
+    if process.returncode != 0:
+        sys.stderr.write(stdout + stderr)
+        raise RuntimeError(f"Compilation failed: {' '.join(command)}")
+
+    front_end, constexpr = None, None
+    if compiler_id == "GNU":
+        front_end, constexpr = parse_gcc_report(stderr)
+    elif compiler_id in ("Clang", "AppleClang"):
+        front_end, constexpr = parse_clang_trace(os.path.splitext(object_file)[0] + ".json")
+    return wall, front_end, constexpr, peak_memory
+
+
+def run_case(args, size, fields):
+    """Compiles one generated translation unit in a fresh process per repetition and keeps the best run."""
+    stem = f"{'field' if fields else 'plain'}_{size}"
+    source_file = os.path.join(args.output, f"{stem}.cpp")
+    object_file = os.path.join(args.output, f"{stem}.o")
+    with open(source_file, "w") as f:
+        f.write(generate_source(size, fields))
+
+    command = [args.compiler, "-std=c++17"] + [f"-I{path}" for path in args.include] + args.flags + ["-c", source_file, "-o", object_file]
+    # Each repetition runs in its own interpreter so that the peak memory is the one of its compiler only.
+    results = []
+    for _ in range(args.repeat):
+        output = subprocess.run(
+            [sys.executable, __file__, "--compile-once", args.compiler_id, object_file, "--"] + command,
+            stdout=subprocess.PIPE,
+            check=True,
+            text=True,
+        ).stdout
+        results.append(json.loads(output))
+
+    def best(key):
+        values = [result[key] for result in results if result[key] is not None]
+        return min(values) if values else None
+
+    return {"size": size, "fields": fields, "wall": best("wall"), "front_end": best("front_end"), "constexpr": best("constexpr"), "peak_memory": best("peak_memory")}
+
+
+def format_table(compiler, rows):
+    def cell(value, digits):
+        return "-" if value is None else f"{value:.{digits}f}"
+
+    lines = [
+        f"Compile-time cost of trlc_enum with {compiler}",
+        "",
+        "| enumerators | TRLC_FIELD | wall (s) | front-end (s) | constexpr (s) | peak memory (MiB) |",
+        "|------------:|:----------:|---------:|--------------:|--------------:|------------------:|",
+    ]
+    for row in rows:
+        fields = "yes" if row["fields"] else "no"
+        lines.append(
+            f"| {row['size']} | {fields} | {cell(row['wall'], 2)} | {cell(row['front_end'], 2)} | {cell(row['constexpr'], 2)} | {cell(row['peak_memory'], 0)} |"
+        )
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    if len(sys.argv) > 1 and sys.argv[1] == "--compile-once":
+        compiler_id, object_file = sys.argv[2], sys.argv[3]
+        wall, front_end, constexpr, peak_memory = compile_once(sys.argv[5:], compiler_id, object_file)
+        print(json.dumps({"wall": wall, "front_end": front_end, "constexpr": constexpr, "peak_memory": peak_memory}))
+        return
+
+    parser = argparse.ArgumentParser(description="Measure the compile-time cost of TRLC_ENUM declarations.")
+    parser.add_argument("--compiler", required=True, help="The C++ compiler.")
+    parser.add_argument("--compiler-id", default="GNU", help="The CMake compiler id: GNU, Clang or AppleClang.")
+    parser.add_argument("--include", action="append", default=[], help="An include directory, repeatable.")
+    parser.add_argument("--flag", dest="flags", action="append", default=[], help="A compiler flag, repeatable.")
+    parser.add_argument("--output", required=True, help="The directory of the generated sources and of summary.md.")
+    parser.add_argument("--sizes", default=",".join(map(str, SIZES)), help="The comma separated numbers of enumerators.")
+    parser.add_argument("--repeat", type=int, default=1, help="The number of compilations of every case, the best is kept.")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    rows = [run_case(args, 0, False)]
+    for size in map(int, args.sizes.split(",")):
+        for fields in (False, True):
+            rows.append(run_case(args, size, fields))
+
+    table = format_table(f"{os.path.basename(args.compiler)} ({args.compiler_id})", rows)
+    with open(os.path.join(args.output, "summary.md"), "w") as f:
+        f.write(table)
+    print(table)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,61 @@
+import sys
+
+SIZES = (4, 16, 64, 256)
+WORDS = (
+    "OK",
+    "TIMEOUT",
+    "NOT_FOUND",
+    "PERMISSION_DENIED",
+    "RETRY",
+    "INTERNAL_SERVER_ERROR",
+    "BUSY",
+    "UNAVAILABLE",
+)
+
+
+def enumerator_name(index):
+    return f"{WORDS[index % len(WORDS)]}_{index}"
+
+
+def sparse_value(index):
+    # Distinct values spread over [-500000, 500002], in a shuffled declaration order.
+    return (index * 2654435761) % 1000003 - 500000
+
+
+def generate_enum(name, size, sparse):
+    lines = [f"TRLC_ENUM({name},"]
+    for index in range(size):
+        enumerator = enumerator_name(index)
+        if sparse:
+            enumerator += f" = TRLC_FIELD(value = {sparse_value(index)}, desc = \"Sparse enumerator {index}.\")"
+        else:
+            enumerator += f" = TRLC_FIELD(desc = \"Dense enumerator {index}.\")"
+        separator = ")" if index == size - 1 else ","
+        lines.append(f"          {enumerator}{separator}")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: python3 generate_bench_enums.py <output_header>")
+        sys.exit(1)
+
+    enums = []
+    for size in SIZES:
+        enums.append(generate_enum(f"Dense{size}", size, False))
+        enums.append(generate_enum(f"Sparse{size}", size, True))
+
+    header = """/**
+ * This file is automatically generated by bench/generate_bench_enums.py.
+ */
+#pragma once
+
+#include "trlc/enum.hpp"
+
+"""
+    with open(sys.argv[1], "w") as f:
+        f.write(header + "\n\n".join(enums) + "\n")
+
+
+if __name__ == "__main__":
+    main()
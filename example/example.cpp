@@ -76,7 +76,7 @@ int main()
 
     std::cout << "Compile time holder check passed." << std::endl;
 
-    // Each enum or enum element has a dump() function that operates at runtime. It returns a JSON string of the properties associated with the enum element and a list of elements for the enum.
+    // Each enum or enum element has a dump() function. It returns a view of a JSON string written at compile time of the properties associated with the enum element and a list of elements for the enum.
 
     std::cout << "[1] Enum Rainbow :";
     std::cout << Rainbow::dump() << std::endl;
@@ -0,0 +1,34 @@
+#include "trlc/enum/macros.hpp"
+
+#include <cstddef>
+#include <iostream>
+
+import trlc.enums;
+
+TRLC_ENUM(Rainbow,
+          RED = TRLC_FIELD(desc = "Red color."),
+          ORANGE,
+          YELLOW,
+          GREEN = TRLC_FIELD(value = 10, desc = "Green color."),
+          BLUE,
+          INDIGO,
+          VIOLET)
+
+TRLC_ENUM_DETAIL(Ports, trlc::AutoEnumDef,
+                 SSH = TRLC_FIELD(value = 22),
+                 HTTP = TRLC_FIELD(value = 80),
+                 HTTPS = TRLC_FIELD(value = 443))
+
+int main()
+{
+    static_assert(Rainbow::fromValue(10).value() == Rainbow::GREEN);
+    static_assert(Ports::fromString("HTTPS").value() == Ports::HTTPS);
+
+    trlc::EnumSet<Rainbow> warm{Rainbow::RED, Rainbow::ORANGE, Rainbow::YELLOW};
+    for (const auto& color : warm)
+    {
+        std::cout << color.name() << std::endl;
+    }
+    std::cout << Rainbow::dump() << std::endl;
+    return 0;
+}
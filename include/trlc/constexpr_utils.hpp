@@ -6,13 +6,31 @@
 #include <cstdint>
 #include <limits>
 #include <optional>
+#include <stdexcept>
 #include <string_view>
+#include <type_traits>
 
 namespace trlc
 {
 namespace constexpr_utils
 {
 
+/**
+ * @brief Selects the smallest unsigned integer type able to represent a given value.
+ *
+ * @tparam N The largest value the type must be able to hold.
+ */
+template<std::size_t N>
+struct smallest_unsigned
+{
+    using type = std::conditional_t<N <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+                                    std::conditional_t<N <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+                                                       std::conditional_t<N <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::uint64_t>>>;
+};
+
+template<std::size_t N>
+using smallest_unsigned_t = typename smallest_unsigned<N>::type;
+
 /**
  * @brief Checks if a substring is contained within a string view.
  *
@@ -32,11 +50,79 @@ constexpr bool contains(std::string_view str, std::string_view substring)
     return str.find(substring) != std::string_view::npos;
 }
 
+/**
+ * @brief Moves an element down a binary max-heap until its children are not greater.
+ *
+ * @param first The first element of the heap.
+ * @param root The index of the element to move.
+ * @param count The number of elements in the heap.
+ * @param less The comparison of two elements.
+ */
+template<class RandomIt, class Less>
+constexpr void sift_down(RandomIt first, std::size_t root, std::size_t count, Less less)
+{
+    while (2 * root + 1 < count)
+    {
+        std::size_t child{2 * root + 1};
+        if (child + 1 < count && less(first[child], first[child + 1]))
+        {
+            ++child;
+        }
+        if (!less(first[root], first[child]))
+        {
+            return;
+        }
+        const auto item{first[root]};
+        first[root] = first[child];
+        first[child] = item;
+        root = child;
+    }
+}
+
+/**
+ * @brief Sorts a range at compile time.
+ *
+ * A heap sort: O(N log N) comparisons without recursion or extra storage, so the
+ * constexpr evaluation of large enums stays far below the compiler limits. It is not stable.
+ *
+ * @param first The first element of the range.
+ * @param last The element past the last one of the range.
+ * @param less The comparison of two elements.
+ */
+template<class RandomIt, class Less>
+constexpr void sort(RandomIt first, RandomIt last, Less less)
+{
+    const auto count{static_cast<std::size_t>(last - first)};
+    for (std::size_t root{count / 2}; root > 0; --root)
+    {
+        sift_down(first, root - 1, count, less);
+    }
+    for (std::size_t end{count}; end > 1; --end)
+    {
+        const auto item{first[0]};
+        first[0] = first[end - 1];
+        first[end - 1] = item;
+        sift_down(first, 0, end - 1, less);
+    }
+}
+
+/**
+ * @brief Sorts a range in ascending order at compile time.
+ *
+ * @param first The first element of the range.
+ * @param last The element past the last one of the range.
+ */
+template<class RandomIt>
+constexpr void sort(RandomIt first, RandomIt last)
+{
+    sort(first, last, [](const auto& lhs, const auto& rhs) { return lhs < rhs; });
+}
+
 /**
  * @brief Checks if all elements in the provided array are unique at compile time.
  *
- * This function iterates over the given array and checks for duplicate elements
- * using nested loops. It returns true if all elements are unique, and false otherwise.
+ * A sorted copy of the array is checked for equal neighbours, O(N log N).
+ * Elements equal to the maximum of T are ignored.
  *
  * @tparam T The type of elements in the array.
  * @tparam N The size of the array.
@@ -50,22 +136,13 @@ template<typename T, std::size_t N>
 constexpr bool has_unique_elements(const std::array<T, N>& arr)
 {
     constexpr auto maximum{std::numeric_limits<T>::max()};
-    for (std::size_t i = 0; i < N; ++i)
+    std::array<T, N> sorted{arr};
+    sort(sorted.begin(), sorted.end());
+    for (std::size_t index{1}; index < N && sorted[index] != maximum; ++index)
     {
-        if (arr[i] == maximum)
+        if (sorted[index - 1] == sorted[index])
         {
-            continue;
-        }
-        for (std::size_t j = i + 1; j < N; ++j)
-        {
-            if (arr[j] == maximum)
-            {
-                continue;
-            }
-            if (arr[i] == arr[j])
-            {
-                return false; // found a duplicate
-            }
+            return false; // found a duplicate
         }
     }
     return true; // all elements are unique
@@ -162,6 +239,740 @@ constexpr std::optional<int64_t> stoi(std::string_view str, std::size_t* pos = n
     return result;
 }
 
+/**
+ * @brief Returns the number of characters of the decimal representation of an integer.
+ *
+ * @param value The integer, of any width and signedness.
+ * @return The number of characters, including the minus sign of negative values.
+ */
+template<typename T>
+constexpr std::size_t integer_size(T value)
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    std::size_t result{1};
+    unsigned_type magnitude{static_cast<unsigned_type>(value)};
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            magnitude = static_cast<unsigned_type>(unsigned_type{0} - magnitude);
+            ++result;
+        }
+    }
+    while (magnitude >= 10)
+    {
+        magnitude /= 10;
+        ++result;
+    }
+    return result;
+}
+
+/**
+ * @brief Writes the decimal representation of an integer to an output iterator.
+ *
+ * Unlike std::to_string it keeps the full width of the integer, and it does not allocate.
+ *
+ * @param value The integer, of any width and signedness.
+ * @param out The output iterator.
+ * @return The output iterator past the last written character.
+ */
+template<typename T, class OutputIt>
+constexpr OutputIt write_integer(T value, OutputIt out)
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    unsigned_type magnitude{static_cast<unsigned_type>(value)};
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            magnitude = static_cast<unsigned_type>(unsigned_type{0} - magnitude);
+            *out++ = '-';
+        }
+    }
+    char digits[std::numeric_limits<unsigned_type>::digits10 + 1]{};
+    std::size_t count{0};
+    do
+    {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    while (count != 0)
+    {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+/**
+ * @brief Writes a string to an output iterator.
+ *
+ * @param str The string to write.
+ * @param out The output iterator.
+ * @return The output iterator past the last written character.
+ */
+template<class OutputIt>
+constexpr OutputIt write_string(std::string_view str, OutputIt out)
+{
+    for (const char c : str)
+    {
+        *out++ = c;
+    }
+    return out;
+}
+
+/**
+ * @brief Returns the smallest power of two greater than or equal to the given value.
+ *
+ * @param value The value to round up.
+ * @return The rounded up power of two (1 for 0).
+ */
+constexpr std::size_t bit_ceil(std::size_t value)
+{
+    std::size_t result{1};
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Counts the bits set in a 64-bit word.
+ *
+ * Uses the compiler builtin where available, which lowers to a single instruction
+ * on targets that have one, and a SWAR reduction otherwise.
+ *
+ * @param word The word to count.
+ * @return The number of bits set.
+ */
+constexpr std::size_t popcount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+    word -= (word >> 1) & 0x5555555555555555ULL;
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief Counts the trailing zero bits of a 64-bit word.
+ *
+ * @param word The word to count, it must not be 0.
+ * @return The index of the lowest bit set.
+ */
+constexpr std::size_t countr_zero(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+    return popcount((word & (~word + 1)) - 1);
+#endif
+}
+
+/**
+ * @brief Returns the number of bits needed to represent a 64-bit word.
+ *
+ * @param word The word.
+ * @return 0 for 0, otherwise one plus the index of the highest bit set.
+ */
+constexpr std::size_t bit_width(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return word == 0 ? 0 : 64 - static_cast<std::size_t>(__builtin_clzll(word));
+#else
+    std::size_t result{0};
+    for (; word != 0; word >>= 1)
+    {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/**
+ * @brief Detects whether the call is evaluated in a constant expression.
+ *
+ * Used to keep runtime-only hints out of constant evaluation. Without std::is_constant_evaluated
+ * or the compiler builtin it conservatively returns true.
+ *
+ * @return True during constant evaluation; otherwise, false.
+ */
+constexpr bool is_constant_evaluated()
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Hints the processor to load the cache line of an address.
+ *
+ * It does nothing during constant evaluation or without compiler support.
+ *
+ * @param address The address to prefetch.
+ */
+constexpr void prefetch(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (!is_constant_evaluated())
+    {
+        __builtin_prefetch(address);
+    }
+#else
+    static_cast<void>(address);
+#endif
+}
+
+/**
+ * @brief Loads 8 bytes as a little-endian 64-bit word.
+ *
+ * Written with shifts so it stays usable in constant expressions; optimizing
+ * compilers merge it into a single load at runtime.
+ *
+ * @param data Pointer to at least 8 readable bytes.
+ * @return The loaded word.
+ */
+constexpr std::uint64_t load_u64(const char* data)
+{
+    return static_cast<std::uint64_t>(static_cast<unsigned char>(data[0])) |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[1])) << 8 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[2])) << 16 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[3])) << 24 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[4])) << 32 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[5])) << 40 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[6])) << 48 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[7])) << 56;
+}
+
+/**
+ * @brief Loads 4 bytes as a little-endian 32-bit word.
+ *
+ * @param data Pointer to at least 4 readable bytes.
+ * @return The loaded word.
+ */
+constexpr std::uint32_t load_u32(const char* data)
+{
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(data[0])) |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(data[1])) << 8 |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(data[2])) << 16 |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(data[3])) << 24;
+}
+
+/**
+ * @brief Packs the last bytes of a buffer into a 64-bit word without a per-byte loop.
+ *
+ * Buffers of 8 bytes or more load their last 8 bytes, shorter buffers combine two
+ * overlapping 32-bit loads or up to three single bytes. Every byte keeps a lane of its own,
+ * so the word identifies the bytes of buffers of the same size and ASCII folding still applies.
+ *
+ * @param data Pointer to the buffer.
+ * @param size The size of the buffer, at least 1.
+ * @return The packed word.
+ */
+constexpr std::uint64_t load_last_u64(const char* data, std::size_t size)
+{
+    if (size >= 8)
+    {
+        return load_u64(data + size - 8);
+    }
+    if (size >= 4)
+    {
+        return load_u32(data) | static_cast<std::uint64_t>(load_u32(data + size - 4)) << 32;
+    }
+    return static_cast<std::uint64_t>(static_cast<unsigned char>(data[0])) |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[size / 2])) << 8 |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(data[size - 1])) << 16;
+}
+
+/**
+ * @brief Finalizes a 64-bit hash so that every input bit affects every output bit.
+ *
+ * @param value The value to mix.
+ * @return The mixed value.
+ */
+constexpr std::uint64_t mix(std::uint64_t value)
+{
+    value ^= value >> 32;
+    value *= 0xD6E8FEB86659FD93ULL;
+    value ^= value >> 32;
+    value *= 0xD6E8FEB86659FD93ULL;
+    value ^= value >> 32;
+    return value;
+}
+
+/**
+ * @brief Converts the ASCII upper case letters of 8 packed bytes to lower case.
+ *
+ * All bytes are classified at once with carry-free additions on their low 7 bits,
+ * bytes outside 'A'..'Z' (including non-ASCII bytes) are left unchanged.
+ *
+ * @param word The 8 packed bytes.
+ * @return The folded bytes.
+ */
+constexpr std::uint64_t to_lower_ascii(std::uint64_t word)
+{
+    constexpr std::uint64_t ones{0x0101010101010101ULL};
+    constexpr std::uint64_t high_bits{0x8080808080808080ULL};
+    const std::uint64_t heptets{word & ~high_bits};
+    const std::uint64_t above_z{heptets + ones * (0x7F - 'Z')};
+    const std::uint64_t from_a{heptets + ones * (0x80 - 'A')};
+    const std::uint64_t upper{(from_a ^ above_z) & ~word & high_bits};
+    return word | (upper >> 2);
+}
+
+/**
+ * @brief Computes a 64-bit hash of a string, consuming 8 bytes per step.
+ *
+ * @tparam FoldCase Whether ASCII letters are folded to lower case before hashing,
+ *                  so that strings differing only in case have the same hash.
+ * @param str The string to hash.
+ * @return The hash value.
+ */
+template<bool FoldCase = false>
+constexpr std::uint64_t hash(std::string_view str)
+{
+    constexpr std::uint64_t multiplier{0x9E3779B97F4A7C15ULL};
+    std::uint64_t result{multiplier ^ str.size()};
+    auto step = [&result](std::uint64_t word)
+    {
+        if constexpr (FoldCase)
+        {
+            word = to_lower_ascii(word);
+        }
+        result = (result ^ word) * multiplier;
+        result ^= result >> 29;
+    };
+    for (std::size_t pos{0}; pos + 8 < str.size(); pos += 8)
+    {
+        step(load_u64(str.data() + pos));
+    }
+    if (!str.empty())
+    {
+        step(load_last_u64(str.data(), str.size()));
+    }
+    return mix(result);
+}
+
+/**
+ * @brief Compares two strings ignoring the case of ASCII letters, 8 bytes per step.
+ *
+ * @param lhs The first string.
+ * @param rhs The second string.
+ * @return True if the strings are equal ignoring case; otherwise false.
+ */
+constexpr bool equal_ignore_case(std::string_view lhs, std::string_view rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (std::size_t pos{0}; pos + 8 < lhs.size(); pos += 8)
+    {
+        if (to_lower_ascii(load_u64(lhs.data() + pos)) != to_lower_ascii(load_u64(rhs.data() + pos)))
+        {
+            return false;
+        }
+    }
+    return lhs.empty() || to_lower_ascii(load_last_u64(lhs.data(), lhs.size())) == to_lower_ascii(load_last_u64(rhs.data(), rhs.size()));
+}
+
+/**
+ * @brief Compares two buffers of the same size 8 bytes at a time.
+ *
+ * @param lhs The first buffer.
+ * @param rhs The second buffer.
+ * @param size The size of both buffers.
+ * @return True if the buffers are equal; otherwise, false.
+ */
+constexpr bool equal_bytes(const char* lhs, const char* rhs, std::size_t size)
+{
+    if (size == 0)
+    {
+        return true;
+    }
+    std::size_t pos{0};
+    for (; pos + 8 < size; pos += 8)
+    {
+        if (load_u64(lhs + pos) != load_u64(rhs + pos))
+        {
+            return false;
+        }
+    }
+    return load_last_u64(lhs + pos, size - pos) == load_last_u64(rhs + pos, size - pos);
+}
+
+/**
+ * @brief A collision-free hash table mapping N precomputed hashes to their index.
+ *
+ * Keys are first split into buckets by the high bits of their hash, then every bucket
+ * gets a seed that places all of its keys into free slots ("hash and displace").
+ * A lookup is one bucket load, one slot load and no probing.
+ *
+ * @tparam N The number of keys.
+ */
+template<std::size_t N>
+struct PerfectHash
+{
+    static constexpr std::size_t BUCKET_COUNT{bit_ceil(N)};  ///< Number of first-level buckets.
+    static constexpr std::size_t SLOT_COUNT{2 * bit_ceil(N)}; ///< Number of slots, at most half full.
+
+    using index_type = smallest_unsigned_t<N>;
+
+    std::array<std::uint16_t, BUCKET_COUNT> seeds{}; ///< Displacement seed of every bucket.
+    std::array<index_type, SLOT_COUNT> slots{};      ///< Key index of every slot or N for empty slots.
+
+    /**
+     * @brief Returns the bucket of a hash.
+     */
+    static constexpr std::size_t bucket(std::uint64_t hash)
+    {
+        return static_cast<std::size_t>(hash >> 32) & (BUCKET_COUNT - 1);
+    }
+
+    /**
+     * @brief Returns the slot of a hash for a given seed.
+     */
+    static constexpr std::size_t slot(std::uint64_t hash, std::uint16_t seed)
+    {
+        return static_cast<std::size_t>(mix(hash + seed * 0x9E3779B97F4A7C15ULL)) & (SLOT_COUNT - 1);
+    }
+
+    /**
+     * @brief Finds the only key index that may match a hash.
+     *
+     * @param hash The hash of the looked up key.
+     * @return The candidate key index, or N if no key can match.
+     */
+    constexpr std::size_t find(std::uint64_t hash) const
+    {
+        return slots[slot(hash, seeds[bucket(hash)])];
+    }
+};
+
+/**
+ * @brief Builds a collision-free hash table at compile time.
+ *
+ * Buckets are placed from the largest to the smallest, trying seeds until all keys
+ * of the bucket land in distinct free slots.
+ *
+ * @tparam N The number of keys.
+ * @param hashes The hash of every key.
+ * @return The perfect hash table.
+ * @throws std::invalid_argument If two keys have the same hash.
+ */
+template<std::size_t N>
+constexpr PerfectHash<N> create_perfect_hash(const std::array<std::uint64_t, N>& hashes)
+{
+    using table_type = PerfectHash<N>;
+    table_type table{};
+    for (std::size_t slot{0}; slot < table_type::SLOT_COUNT; ++slot)
+    {
+        table.slots[slot] = static_cast<typename table_type::index_type>(N);
+    }
+
+    // Group the keys by bucket.
+    std::array<std::size_t, table_type::BUCKET_COUNT + 1> starts{};
+    for (std::size_t index{0}; index < N; ++index)
+    {
+        ++starts[table_type::bucket(hashes[index]) + 1];
+    }
+    std::size_t largest_bucket{0};
+    for (std::size_t bucket{0}; bucket < table_type::BUCKET_COUNT; ++bucket)
+    {
+        largest_bucket = starts[bucket + 1] > largest_bucket ? starts[bucket + 1] : largest_bucket;
+        starts[bucket + 1] += starts[bucket];
+    }
+    std::array<std::size_t, N> keys{};
+    std::array<std::size_t, table_type::BUCKET_COUNT> cursors{};
+    for (std::size_t index{0}; index < N; ++index)
+    {
+        const auto bucket{table_type::bucket(hashes[index])};
+        keys[starts[bucket] + cursors[bucket]++] = index;
+    }
+
+    std::array<bool, table_type::SLOT_COUNT> used{};
+    std::array<std::size_t, N> candidates{};
+    for (std::size_t bucket_size{largest_bucket}; bucket_size > 0; --bucket_size)
+    {
+        for (std::size_t bucket{0}; bucket < table_type::BUCKET_COUNT; ++bucket)
+        {
+            const auto first{starts[bucket]};
+            if (starts[bucket + 1] - first != bucket_size)
+            {
+                continue;
+            }
+            for (std::size_t i{first}; i < first + bucket_size; ++i)
+            {
+                for (std::size_t j{i + 1}; j < first + bucket_size; ++j)
+                {
+                    if (hashes[keys[i]] == hashes[keys[j]])
+                    {
+                        throw std::invalid_argument("Keys must have distinct hashes!");
+                    }
+                }
+            }
+
+            bool placed{false};
+            for (std::uint32_t seed{0}; seed <= std::numeric_limits<std::uint16_t>::max() && !placed; ++seed)
+            {
+                placed = true;
+                for (std::size_t i{0}; i < bucket_size && placed; ++i)
+                {
+                    candidates[i] = table_type::slot(hashes[keys[first + i]], static_cast<std::uint16_t>(seed));
+                    placed = !used[candidates[i]];
+                    for (std::size_t j{0}; j < i && placed; ++j)
+                    {
+                        placed = candidates[i] != candidates[j];
+                    }
+                }
+                if (placed)
+                {
+                    table.seeds[bucket] = static_cast<std::uint16_t>(seed);
+                    for (std::size_t i{0}; i < bucket_size; ++i)
+                    {
+                        used[candidates[i]] = true;
+                        table.slots[candidates[i]] = static_cast<typename table_type::index_type>(keys[first + i]);
+                    }
+                }
+            }
+            if (!placed)
+            {
+                throw std::invalid_argument("Unable to build a perfect hash!");
+            }
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief A prefix tree over N keys, matching the longest key at the start of a buffer.
+ *
+ * The nodes are numbered in breadth-first order with node 0 as the root, so the children of
+ * node i are the contiguous nodes [children[i], children[i + 1]) and a step scans a few
+ * adjacent labels instead of chasing sibling links. A node ending a key records its index.
+ * Chains of nodes with a single child are skipped by comparing their labels 8 bytes at a time,
+ * and once the walk reaches a node below which a single key remains, the rest of that key is
+ * compared the same way instead of walking one node per byte.
+ *
+ * @tparam NodeCount The number of nodes, at most 1 + the total size of the keys.
+ * @tparam N The number of keys.
+ */
+template<std::size_t NodeCount, std::size_t N>
+struct Trie
+{
+    using index_type = smallest_unsigned_t<(NodeCount > N ? NodeCount : N)>;
+
+    std::array<char, NodeCount> labels{};             ///< The character leading to every node.
+    std::array<index_type, NodeCount + 1> children{}; ///< The first child of every node, children[size] closes the last range.
+    std::array<index_type, NodeCount> keys{};         ///< The key ending at every node, N if none.
+    std::array<index_type, NodeCount> single{};       ///< The only key at or below every node, N if there are several.
+    std::array<index_type, NodeCount> jumps{};        ///< The end of the chain of single children below every node.
+    std::array<index_type, NodeCount> runs{};         ///< The number of labels of that chain, 0 if there is none.
+    std::array<index_type, NodeCount> sources{};      ///< A key ending at a leaf below every node, whose bytes are the labels.
+    std::array<index_type, NodeCount> depths{};       ///< The number of labels from the root to every node.
+    std::array<std::string_view, N> names{};          ///< The keys.
+    std::size_t size{1};                              ///< The number of nodes in use.
+
+    /**
+     * @brief The result of a match.
+     */
+    struct Match
+    {
+        std::size_t key;  ///< The index of the longest matching key, N if no key matches.
+        const char* last; ///< The end of the match, the start of the buffer if no key matches.
+    };
+
+    /**
+     * @brief Finds the longest key that is a prefix of a buffer, reading every byte at most once.
+     *
+     * @param first The start of the buffer.
+     * @param last The end of the buffer.
+     * @return The longest matching key and the end of the match.
+     */
+    constexpr Match match(const char* first, const char* last) const
+    {
+        Match result{N, first};
+        std::size_t node{0};
+        const char* current{first};
+        while (true)
+        {
+            const auto available{static_cast<std::size_t>(last - current)};
+            if (single[node] != N)
+            {
+                const std::string_view name{names[single[node]]};
+                const std::size_t rest{name.size() - depths[node]};
+                if (available >= rest && equal_bytes(current, name.data() + depths[node], rest))
+                {
+                    result = Match{single[node], current + rest};
+                }
+                return result;
+            }
+            if (runs[node] != 0)
+            {
+                const std::size_t run{runs[node]};
+                if (available < run || !equal_bytes(current, names[sources[node]].data() + depths[node], run))
+                {
+                    return result;
+                }
+                current += run;
+                node = jumps[node];
+            }
+            else
+            {
+                if (available == 0)
+                {
+                    return result;
+                }
+                std::size_t child{children[node]};
+                const std::size_t end{children[node + 1]};
+                while (child != end && labels[child] != *current)
+                {
+                    ++child;
+                }
+                if (child == end)
+                {
+                    return result;
+                }
+                node = child;
+                ++current;
+            }
+            if (keys[node] != N)
+            {
+                result = Match{keys[node], current};
+            }
+        }
+    }
+};
+
+/**
+ * @brief Creates a prefix tree from a set of keys.
+ *
+ * The keys are first inserted in a tree linking every node to its first child and next sibling,
+ * which is then renumbered in breadth-first order.
+ *
+ * @tparam NodeCount The number of nodes, at least 1 + the total size of the keys.
+ * @tparam N The number of keys.
+ * @param keys The keys, not empty and distinct.
+ * @return The prefix tree.
+ * @throws std::invalid_argument If a key is empty or two keys are equal.
+ */
+template<std::size_t NodeCount, std::size_t N>
+constexpr Trie<NodeCount, N> create_trie(const std::array<std::string_view, N>& keys)
+{
+    using trie_type = Trie<NodeCount, N>;
+    using index_type = typename trie_type::index_type;
+
+    std::array<char, NodeCount> labels{};
+    std::array<std::size_t, NodeCount> first_child{};
+    std::array<std::size_t, NodeCount> next_sibling{};
+    std::array<std::size_t, NodeCount> node_keys{};
+    for (auto& key : node_keys)
+    {
+        key = N;
+    }
+    std::size_t size{1};
+
+    for (std::size_t index{0}; index < N; ++index)
+    {
+        if (keys[index].empty())
+        {
+            throw std::invalid_argument("Keys must not be empty!");
+        }
+        std::size_t node{0};
+        for (const char c : keys[index])
+        {
+            std::size_t child{first_child[node]};
+            while (child != 0 && labels[child] != c)
+            {
+                child = next_sibling[child];
+            }
+            if (child == 0)
+            {
+                child = size++;
+                labels[child] = c;
+                next_sibling[child] = first_child[node];
+                first_child[node] = child;
+            }
+            node = child;
+        }
+        if (node_keys[node] != N)
+        {
+            throw std::invalid_argument("Keys must be distinct!");
+        }
+        node_keys[node] = index;
+    }
+
+    // Renumber in breadth-first order, the queue holding the old number of every new node.
+    trie_type trie{};
+    trie.size = size;
+    std::array<std::size_t, NodeCount> queue{};
+    std::size_t queued{1};
+    for (std::size_t node{0}; node < size; ++node)
+    {
+        const std::size_t old_node{queue[node]};
+        trie.labels[node] = labels[old_node];
+        trie.keys[node] = static_cast<index_type>(node_keys[old_node]);
+        trie.children[node] = static_cast<index_type>(queued);
+        for (std::size_t child{first_child[old_node]}; child != 0; child = next_sibling[child])
+        {
+            queue[queued++] = child;
+        }
+    }
+    trie.children[size] = static_cast<index_type>(queued);
+    for (std::size_t node{size + 1}; node <= NodeCount; ++node)
+    {
+        trie.children[node] = static_cast<index_type>(queued);
+    }
+
+    for (std::size_t node{0}; node < size; ++node)
+    {
+        for (std::size_t child{trie.children[node]}; child < trie.children[node + 1]; ++child)
+        {
+            trie.depths[child] = static_cast<index_type>(trie.depths[node] + 1);
+        }
+    }
+
+    // Children follow their parent in breadth-first order, so a reverse scan sees them first.
+    std::array<std::size_t, NodeCount> key_counts{};
+    for (std::size_t node{size}; node-- > 0;)
+    {
+        const std::size_t first{trie.children[node]};
+        const std::size_t last{trie.children[node + 1]};
+        key_counts[node] += trie.keys[node] != N ? 1 : 0;
+        std::size_t only{trie.keys[node]};
+        for (std::size_t child{first}; child < last; ++child)
+        {
+            key_counts[node] += key_counts[child];
+            only = trie.single[child] != N ? trie.single[child] : only;
+        }
+        trie.single[node] = static_cast<index_type>(key_counts[node] == 1 ? only : N);
+        trie.sources[node] = first == last ? trie.keys[node] : trie.sources[first];
+
+        // A single child without a key is skipped along with the chain below it.
+        if (last - first == 1)
+        {
+            const bool extends{trie.keys[first] == N && trie.runs[first] != 0};
+            trie.runs[node] = static_cast<index_type>(extends ? trie.runs[first] + 1 : 1);
+            trie.jumps[node] = extends ? trie.jumps[first] : static_cast<index_type>(first);
+        }
+    }
+    trie.names = keys;
+    return trie;
+}
+
 } // namespace constexpr_utils
 
 } // namespace trlc
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "enum/atomic.hpp"  // IWYU pragma: export
+#include "enum/counter.hpp" // IWYU pragma: export
 #include "enum/detail.hpp"
-#include "enum/field.hpp" // IWYU pragma: export
-
-#include "macro.hpp" // IWYU pragma: export
+#include "enum/field.hpp"   // IWYU pragma: export
+#include "enum/macros.hpp"  // IWYU pragma: export
+#include "enum/map.hpp"     // IWYU pragma: export
+#include "enum/set.hpp"     // IWYU pragma: export
+#include "enum/unknown.hpp" // IWYU pragma: export
 
 #include <cstdint>
 
@@ -21,45 +25,29 @@ namespace trlc
  * struct similar to this one. Custom EnumDefs can be passed to the
  * TRLC_ENUM_DETAIL macro to modify the behavior of enum management
  * in accordance with specific needs.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @tparam ValueSearchPolicy The policy used to search enum values.
+ * @tparam NameSearchPolicy The policy used to search enum names.
  */
-template<class Holder>
+template<class Holder, class ValueSearchPolicy = trlc::policy::BinarySearchPolicy, class NameSearchPolicy = trlc::policy::CaseSensitiveStringSearchPolicy>
 struct DefaultEnumDef
 {
     using holder = Holder;
     using value_type = int64_t;
-    using value_search_policy = trlc::policy::BinarySearchPolicy;
-    using name_search_policy = trlc::policy::CaseSensitiveStringSearchPolicy;
+    using value_search_policy = ValueSearchPolicy;
+    using name_search_policy = NameSearchPolicy;
     using unknown_policy = trlc::policy::UnknownPolicy;
     using enum_type = trlc::Enum<value_type, holder>;
     using iterator = trlc::EnumIterator<holder>;
 };
 
 /**
- * @brief Macro to define a Default TRLC Enum with a given name and an arbitrary number of enumeration values.
- *
- * This macro expands into a call to a detailed macro that performs the actual enum definition logic.
+ * @brief The default EnumDef with the search policies selected at compile time by AutoSearchPolicy.
  *
- * @param enumname The name of the enum being defined.
- * @param ... A variable number of enumeration values, which can include:
- *   - Normal enum values
- *   - TRLC_FIELD directives for value and descriptions,
- *     allowing for rich metadata associated with each enum value.
- *
- * @example
- * Example usage of the TRLC_ENUM macro to define an enumeration.
- *
- * TRLC_ENUM(Colors,
- *         RED,
- *         GREEN = TRLC_FIELD(value = 1),
- *         BLUE = TRLC_FIELD(desc = "Sky color"),
- *         YELLOW = TRLC_FIELD(value = 2, desc = "Color of ripe bananas."))
- * In this example, we define an enumeration called Colors with several values:
- * - RED: A regular enumerator with no associated metadata.
- * - GREEN: Assigned a value of 1.
- * - BLUE: Has a description indicating it is the color of the sky.
- * - YELLOW: Assigned a value of 2 and a description relating to ripe bananas.
+ * Pass it to TRLC_ENUM_DETAIL, e.g. TRLC_ENUM_DETAIL(Colors, trlc::AutoEnumDef, RED, GREEN).
  */
-#define TRLC_ENUM(enumname, ...) \
-    TRLC_ENUM_DETAIL(enumname, trlc::DefaultEnumDef, __VA_ARGS__)
+template<class Holder>
+using AutoEnumDef = DefaultEnumDef<Holder, trlc::policy::AutoSearchPolicy, trlc::policy::AutoSearchPolicy>;
 
 } // namespace trlc
\ No newline at end of file
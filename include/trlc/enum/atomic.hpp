@@ -0,0 +1,235 @@
+#pragma once
+
+#include "trlc/enum/set.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace trlc
+{
+
+/**
+ * @brief An atomic cell holding one enum of a Holder.
+ *
+ * Only the ordinal of the enum is stored, in a std::atomic of the smallest unsigned type
+ * able to hold it, so the cell is lock-free wherever atomics of that width are, e.g. on
+ * x86-64 and AArch64. The operations mirror std::atomic and convert the ordinals back to
+ * the enum_type of the Holder.
+ *
+ * @tparam Holder The holder class of the enum, e.g. the name given to TRLC_ENUM.
+ */
+template<class Holder>
+struct AtomicEnum
+{
+    using value_type = typename Holder::enum_type;                 ///< The type of the stored enum.
+    using ordinal_type = typename Holder::enum_type::ordinal_type; ///< The type of the stored ordinal.
+
+    static constexpr bool is_always_lock_free{std::atomic<ordinal_type>::is_always_lock_free};
+
+    std::atomic<ordinal_type> m_ordinal{}; ///< The ordinal of the stored enum.
+
+    /**
+     * @brief Constructs an AtomicEnum holding the first enum in EnumIterator order.
+     */
+    AtomicEnum() = default;
+
+    /**
+     * @brief Constructs an AtomicEnum holding an enum.
+     *
+     * @param desired The initial enum.
+     */
+    constexpr AtomicEnum(value_type desired) noexcept
+        : m_ordinal{static_cast<ordinal_type>(desired.ordinal())}
+    {
+    }
+
+    AtomicEnum(const AtomicEnum&) = delete;
+    AtomicEnum& operator=(const AtomicEnum&) = delete;
+
+    /**
+     * @brief Checks whether the operations on this object are lock-free.
+     *
+     * @return True if the operations are lock-free; otherwise, false.
+     */
+    bool is_lock_free() const noexcept
+    {
+        return m_ordinal.is_lock_free();
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum.
+     *
+     * @param desired The enum to store.
+     * @param order The memory order of the operation.
+     */
+    void store(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        m_ordinal.store(static_cast<ordinal_type>(desired.ordinal()), order);
+    }
+
+    /**
+     * @brief Atomically loads the stored enum.
+     *
+     * @param order The memory order of the operation.
+     * @return The stored enum.
+     */
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return toEnum(m_ordinal.load(order));
+    }
+
+    /**
+     * @brief Atomically loads the stored enum, as load().
+     */
+    operator value_type() const noexcept
+    {
+        return load();
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum, as store().
+     *
+     * @param desired The enum to store.
+     * @return The stored enum.
+     */
+    value_type operator=(value_type desired) noexcept
+    {
+        store(desired);
+        return desired;
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum and returns the previous one.
+     *
+     * @param desired The enum to store.
+     * @param order The memory order of the operation.
+     * @return The previously stored enum.
+     */
+    value_type exchange(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return toEnum(m_ordinal.exchange(static_cast<ordinal_type>(desired.ordinal()), order));
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if it is expected, may fail spuriously.
+     *
+     * @param expected The expected enum, set to the stored enum on failure.
+     * @param desired The enum to store.
+     * @param success The memory order of the read-modify-write operation.
+     * @param failure The memory order of the load on failure.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool compare_exchange_weak(value_type& expected, value_type desired, std::memory_order success, std::memory_order failure) noexcept
+    {
+        ordinal_type ordinal{static_cast<ordinal_type>(expected.ordinal())};
+        const bool result{m_ordinal.compare_exchange_weak(ordinal, static_cast<ordinal_type>(desired.ordinal()), success, failure)};
+        expected = toEnum(ordinal);
+        return result;
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if it is expected, may fail spuriously.
+     *
+     * @param expected The expected enum, set to the stored enum on failure.
+     * @param desired The enum to store.
+     * @param order The memory order of the operation.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool compare_exchange_weak(value_type& expected, value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_weak(expected, desired, order, failureOrder(order));
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if it is expected.
+     *
+     * @param expected The expected enum, set to the stored enum on failure.
+     * @param desired The enum to store.
+     * @param success The memory order of the read-modify-write operation.
+     * @param failure The memory order of the load on failure.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool compare_exchange_strong(value_type& expected, value_type desired, std::memory_order success, std::memory_order failure) noexcept
+    {
+        ordinal_type ordinal{static_cast<ordinal_type>(expected.ordinal())};
+        const bool result{m_ordinal.compare_exchange_strong(ordinal, static_cast<ordinal_type>(desired.ordinal()), success, failure)};
+        expected = toEnum(ordinal);
+        return result;
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if it is expected.
+     *
+     * @param expected The expected enum, set to the stored enum on failure.
+     * @param desired The enum to store.
+     * @param order The memory order of the operation.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool compare_exchange_strong(value_type& expected, value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order, failureOrder(order));
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if the stored enum is in a set.
+     *
+     * The state transition of a state machine shared between threads: the stored enum is
+     * replaced only from one of the allowed states, retrying while other threads change it
+     * to another allowed state.
+     *
+     * @param from The states the transition is allowed from.
+     * @param desired The enum to store.
+     * @param current Set to the enum replaced on success, to the stored enum outside of from on failure.
+     * @param order The memory order of the read-modify-write operation.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool transition(const EnumSet<Holder>& from, value_type desired, value_type& current, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        const auto desired_ordinal{static_cast<ordinal_type>(desired.ordinal())};
+        ordinal_type ordinal{m_ordinal.load(failureOrder(order))};
+        do
+        {
+            current = toEnum(ordinal);
+            if (!from.contains(current))
+            {
+                return false;
+            }
+        } while (!m_ordinal.compare_exchange_weak(ordinal, desired_ordinal, order, failureOrder(order)));
+        return true;
+    }
+
+    /**
+     * @brief Atomically replaces the stored enum by desired if the stored enum is in a set.
+     *
+     * @param from The states the transition is allowed from.
+     * @param desired The enum to store.
+     * @param order The memory order of the read-modify-write operation.
+     * @return True if the stored enum was replaced; otherwise, false.
+     */
+    bool transition(const EnumSet<Holder>& from, value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_type current{};
+        return transition(from, desired, current, order);
+    }
+
+private:
+    static value_type toEnum(std::size_t ordinal) noexcept
+    {
+        return Holder::m_array[ordinal];
+    }
+
+    static constexpr std::memory_order failureOrder(std::memory_order order) noexcept
+    {
+        if (order == std::memory_order_acq_rel)
+        {
+            return std::memory_order_acquire;
+        }
+        if (order == std::memory_order_release)
+        {
+            return std::memory_order_relaxed;
+        }
+        return order;
+    }
+};
+
+} // namespace trlc
@@ -0,0 +1,386 @@
+#pragma once
+
+#include "trlc/constexpr_utils.hpp"
+#include "trlc/enum/detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRLC_BATCH_SSE2
+#endif
+
+namespace trlc
+{
+namespace batch
+{
+
+/**
+ * @brief The number of values validated before they are decoded, small enough to stay in the L1 cache.
+ */
+inline constexpr std::size_t BLOCK_SIZE{1024};
+
+/**
+ * @brief The minimum number of names converted by each thread of from_strings.
+ */
+inline constexpr std::size_t MIN_STRINGS_PER_THREAD{4096};
+
+#if !defined(__AVX2__) && (defined(__SSE4_2__) || defined(TRLC_BATCH_SSE2))
+/**
+ * @brief Compares the signed 64-bit lanes of two vectors.
+ *
+ * SSE2 has no 64-bit comparison, it is emulated from 32-bit ones: a lane is greater if its high
+ * half is greater, or if the high halves are equal and its low half is greater as unsigned.
+ * The sign bits of the low halves are flipped so that the signed comparison orders them as unsigned.
+ *
+ * @param a The left operands.
+ * @param b The right operands.
+ * @return All bits set in the lanes where a > b, none elsewhere.
+ */
+inline __m128i cmpgt_epi64(__m128i a, __m128i b)
+{
+#if defined(__SSE4_2__)
+    return _mm_cmpgt_epi64(a, b);
+#else
+    const __m128i low_sign{_mm_set_epi32(0, INT32_MIN, 0, INT32_MIN)};
+    const __m128i biased_a{_mm_xor_si128(a, low_sign)};
+    const __m128i biased_b{_mm_xor_si128(b, low_sign)};
+    const __m128i greater{_mm_cmpgt_epi32(biased_a, biased_b)};
+    const __m128i equal{_mm_cmpeq_epi32(biased_a, biased_b)};
+    const __m128i high_greater{_mm_shuffle_epi32(greater, _MM_SHUFFLE(3, 3, 1, 1))};
+    const __m128i high_equal{_mm_shuffle_epi32(equal, _MM_SHUFFLE(3, 3, 1, 1))};
+    const __m128i low_greater{_mm_shuffle_epi32(greater, _MM_SHUFFLE(2, 2, 0, 0))};
+    return _mm_or_si128(high_greater, _mm_and_si128(high_equal, low_greater));
+#endif
+}
+#endif
+
+/**
+ * @brief Finds the first value outside of [min, max].
+ *
+ * 64-bit values are compared 4 at a time with AVX2 or 2 at a time with SSE2, 32-bit values
+ * 8 at a time with AVX2 or 4 at a time with SSE2. Other types, and the tail, are compared one at a time.
+ *
+ * @param values The values to check.
+ * @param count The number of values.
+ * @param min The smallest valid value.
+ * @param max The largest valid value.
+ * @return The index of the first value out of range, count if all are in range.
+ */
+template<typename T>
+inline std::size_t first_out_of_range(const T* values, std::size_t count, T min, T max)
+{
+    std::size_t index{0};
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, std::int64_t>)
+    {
+        const __m256i lower{_mm256_set1_epi64x(min)};
+        const __m256i upper{_mm256_set1_epi64x(max)};
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m256i block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index))};
+            const __m256i outside{_mm256_or_si256(_mm256_cmpgt_epi64(lower, block), _mm256_cmpgt_epi64(block, upper))};
+            const int mask{_mm256_movemask_pd(_mm256_castsi256_pd(outside))};
+            if (mask != 0)
+            {
+                return index + trlc::constexpr_utils::countr_zero(static_cast<std::uint64_t>(mask));
+            }
+        }
+    }
+    if constexpr (std::is_same_v<T, std::int32_t>)
+    {
+        const __m256i lower{_mm256_set1_epi32(min)};
+        const __m256i upper{_mm256_set1_epi32(max)};
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m256i block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index))};
+            const __m256i outside{_mm256_or_si256(_mm256_cmpgt_epi32(lower, block), _mm256_cmpgt_epi32(block, upper))};
+            const int mask{_mm256_movemask_ps(_mm256_castsi256_ps(outside))};
+            if (mask != 0)
+            {
+                return index + trlc::constexpr_utils::countr_zero(static_cast<std::uint64_t>(mask));
+            }
+        }
+    }
+#elif defined(__SSE4_2__) || defined(TRLC_BATCH_SSE2)
+    if constexpr (std::is_same_v<T, std::int64_t>)
+    {
+        const __m128i lower{_mm_set1_epi64x(min)};
+        const __m128i upper{_mm_set1_epi64x(max)};
+        for (; index + 2 <= count; index += 2)
+        {
+            const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index))};
+            const __m128i outside{_mm_or_si128(cmpgt_epi64(lower, block), cmpgt_epi64(block, upper))};
+            const int mask{_mm_movemask_pd(_mm_castsi128_pd(outside))};
+            if (mask != 0)
+            {
+                return index + trlc::constexpr_utils::countr_zero(static_cast<std::uint64_t>(mask));
+            }
+        }
+    }
+    if constexpr (std::is_same_v<T, std::int32_t>)
+    {
+        const __m128i lower{_mm_set1_epi32(min)};
+        const __m128i upper{_mm_set1_epi32(max)};
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index))};
+            const __m128i outside{_mm_or_si128(_mm_cmpgt_epi32(lower, block), _mm_cmpgt_epi32(block, upper))};
+            const int mask{_mm_movemask_ps(_mm_castsi128_ps(outside))};
+            if (mask != 0)
+            {
+                return index + trlc::constexpr_utils::countr_zero(static_cast<std::uint64_t>(mask));
+            }
+        }
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        if (values[index] < min || values[index] > max)
+        {
+            return index;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Finds the ordinal of a value with a branch-free binary search.
+ *
+ * The number of steps only depends on the size of the Holder, the comparisons compile
+ * to conditional moves.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param value The value to search for.
+ * @return The ordinal of the value, Holder::m_size if it is not a value of the Holder.
+ */
+template<class Holder>
+inline std::size_t branchless_search(typename Holder::value_type value)
+{
+    const auto* base{sorted_values<Holder>.data()};
+    std::size_t length{Holder::m_size};
+    while (length > 1)
+    {
+        const std::size_t half{length / 2};
+        base = (base[half] <= value) ? base + half : base;
+        length -= half;
+    }
+    return *base == value ? static_cast<std::size_t>(base - sorted_values<Holder>.data()) : Holder::m_size;
+}
+
+/**
+ * @brief Converts a sequence of values to enums.
+ *
+ * Values of dense Holders (see policy::DenseTableSearchPolicy) are range checked a block at a time
+ * with first_out_of_range and then decoded through the dense table, values of sparse Holders are
+ * decoded with branchless_search.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param values The values to convert.
+ * @param count The number of values.
+ * @param out The converted enums, at least count of them. The enums from the first invalid value on are left unchanged.
+ * @return The index of the first value that is not a value of the Holder, count if all are valid.
+ */
+template<class Holder>
+inline std::size_t from_values(const typename Holder::value_type* values, std::size_t count, typename Holder::enum_type* out)
+{
+    using DenseTable = trlc::policy::DenseTableSearchPolicy;
+
+    if constexpr (DenseTable::isDense<Holder>())
+    {
+        constexpr auto min{sorted_values<Holder>[0]};
+        constexpr auto max{sorted_values<Holder>[Holder::m_size - 1]};
+        constexpr bool contiguous{DenseTable::distance<Holder>() + 1 == Holder::m_size};
+
+        for (std::size_t start{0}; start < count; start += BLOCK_SIZE)
+        {
+            const std::size_t length{count - start < BLOCK_SIZE ? count - start : BLOCK_SIZE};
+            const std::size_t valid{first_out_of_range(values + start, length, min, max)};
+            for (std::size_t index{start}; index < start + valid; ++index)
+            {
+                const std::uint64_t offset{static_cast<std::uint64_t>(values[index]) - static_cast<std::uint64_t>(min)};
+                if constexpr (contiguous)
+                {
+                    out[index] = Holder::m_array[offset];
+                }
+                else
+                {
+                    const std::size_t ordinal{DenseTable::m_table<Holder>[offset]};
+                    if (ordinal == Holder::m_size)
+                    {
+                        return index;
+                    }
+                    out[index] = Holder::m_array[ordinal];
+                }
+            }
+            if (valid != length)
+            {
+                return start + valid;
+            }
+        }
+        return count;
+    }
+    else
+    {
+        for (std::size_t index{0}; index < count; ++index)
+        {
+            const std::size_t ordinal{branchless_search<Holder>(values[index])};
+            if (ordinal == Holder::m_size)
+            {
+                return index;
+            }
+            out[index] = Holder::m_array[ordinal];
+        }
+        return count;
+    }
+}
+
+/**
+ * @brief Converts a range of names to enums, recording failures in an error bitmap.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param names The names to convert.
+ * @param first The index of the first name of the range, a multiple of 64.
+ * @param last The index past the last name of the range.
+ * @param out The converted enums, indexed like names.
+ * @param errors The error bitmap, indexed like names.
+ * @return The number of names that are not names of the Holder.
+ */
+template<class Holder>
+inline std::size_t from_strings_range(const std::string_view* names, std::size_t first, std::size_t last, typename Holder::enum_type* out, std::uint64_t* errors)
+{
+    using StringSearchPolicy = typename Holder::enum_def::name_search_policy;
+
+    std::size_t failures{0};
+    for (std::size_t word_start{first}; word_start < last; word_start += 64)
+    {
+        const std::size_t word_end{last - word_start < 64 ? last : word_start + 64};
+        std::uint64_t word{0};
+        for (std::size_t index{word_start}; index < word_end; ++index)
+        {
+            const std::optional<std::size_t> found{StringSearchPolicy::template search<Holder>(names[index])};
+            if (found)
+            {
+                out[index] = Holder::m_array[*found];
+            }
+            else
+            {
+                word |= std::uint64_t{1} << (index - word_start);
+            }
+        }
+        errors[word_start / 64] = word;
+        failures += trlc::constexpr_utils::popcount(word);
+    }
+    return failures;
+}
+
+/**
+ * @brief Converts a sequence of names to enums with the name search policy of the Holder.
+ *
+ * Large inputs are split in ranges of whole bitmap words across thread_count threads, the calling
+ * thread converting the first range, so no synchronization is needed beyond joining the threads.
+ * If a thread cannot be started, the calling thread converts the ranges left itself.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param names The names to convert.
+ * @param count The number of names.
+ * @param out The converted enums, at least count of them. The enums of invalid names are left unchanged.
+ * @param errors The error bitmap, at least (count + 63) / 64 words. Bit i % 64 of word i / 64 is set if names[i] is invalid.
+ * @param thread_count The maximum number of threads, each converting at least MIN_STRINGS_PER_THREAD names.
+ * @return The number of names that are not names of the Holder.
+ */
+template<class Holder>
+inline std::size_t from_strings(const std::string_view* names, std::size_t count, typename Holder::enum_type* out, std::uint64_t* errors, std::size_t thread_count = 1)
+{
+    const std::size_t max_threads{(count + MIN_STRINGS_PER_THREAD - 1) / MIN_STRINGS_PER_THREAD};
+    thread_count = thread_count < max_threads ? thread_count : max_threads;
+    if (thread_count <= 1)
+    {
+        return from_strings_range<Holder>(names, 0, count, out, errors);
+    }
+
+    const std::size_t words{(count + 63) / 64};
+    const std::size_t words_per_range{(words + thread_count - 1) / thread_count};
+    const std::size_t ranges{(words + words_per_range - 1) / words_per_range};
+    const auto convert{[=](std::size_t range)
+                       {
+                           const std::size_t first{range * words_per_range * 64};
+                           const std::size_t last{first + words_per_range * 64 < count ? first + words_per_range * 64 : count};
+                           return from_strings_range<Holder>(names, first, last, out, errors);
+                       }};
+
+    std::vector<std::size_t> failures(ranges, 0);
+    std::vector<std::thread> threads{};
+    threads.reserve(ranges - 1);
+    std::size_t range{1};
+    try
+    {
+        for (; range < ranges; ++range)
+        {
+            threads.emplace_back([&failures, convert, range]()
+                                 { failures[range] = convert(range); });
+        }
+    }
+    catch (const std::system_error&)
+    {
+        // No more threads can be started, the calling thread converts the ranges left.
+    }
+    for (; range < ranges; ++range)
+    {
+        failures[range] = convert(range);
+    }
+    failures[0] = convert(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::size_t result{0};
+    for (const auto& failure : failures)
+    {
+        result += failure;
+    }
+    return result;
+}
+
+/**
+ * @brief The batch conversions of the enums of a Holder, called by their fromValues and fromStrings members.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+struct Converter
+{
+    /**
+     * @brief Converts a sequence of values to enums, see from_values.
+     */
+    static std::size_t fromValues(const typename Holder::value_type* values, std::size_t count, typename Holder::enum_type* out)
+    {
+        return from_values<Holder>(values, count, out);
+    }
+
+    /**
+     * @brief Converts a sequence of names to enums, see from_strings.
+     */
+    static std::size_t fromStrings(const std::string_view* names, std::size_t count, typename Holder::enum_type* out, std::uint64_t* errors, std::size_t thread_count)
+    {
+        return from_strings<Holder>(names, count, out, errors, thread_count);
+    }
+};
+
+} // namespace batch
+} // namespace trlc
+
+#undef TRLC_BATCH_SSE2
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "trlc/enum/map.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace trlc
+{
+
+/**
+ * @brief The size of a cache line assumed to pad the data written by different threads.
+ */
+inline constexpr std::size_t CACHE_LINE_SIZE{64};
+
+/**
+ * @brief Returns a small index of the calling thread.
+ *
+ * The threads are numbered from 0 in the order of their first call, the index of a thread
+ * never changes.
+ *
+ * @return The index of the calling thread.
+ */
+inline std::size_t this_thread_index() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index{next.fetch_add(1, std::memory_order_relaxed)};
+    return index;
+}
+
+/**
+ * @brief Counters of the occurrences of the enums of a Holder, updated from many threads.
+ *
+ * Every thread increments the counters of one of ShardCount shards, chosen from its
+ * this_thread_index(), so threads on different shards never write the same cache line.
+ * A shard holds one counter per enum indexed by ordinal and is padded to whole cache lines.
+ * Increments are single relaxed fetch_add, wait-free, and the shards are only summed when
+ * a snapshot is taken.
+ *
+ * @tparam Holder The holder class of the enum, e.g. the name given to TRLC_ENUM.
+ * @tparam ShardCount The number of shards, threads beyond it share the shards.
+ */
+template<class Holder, std::size_t ShardCount = 16>
+struct EnumCounter
+{
+    static_assert(ShardCount > 0, "EnumCounter needs at least one shard.");
+
+    using key_type = typename Holder::enum_type;       ///< The type of the counted enums.
+    using count_type = std::uint64_t;                  ///< The type of the counters.
+    using snapshot_type = EnumMap<Holder, count_type>; ///< The type of the aggregated counters.
+
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::array<std::atomic<count_type>, Holder::size()> m_counts{}; ///< The counters of the shard indexed by ordinal.
+    };
+
+    std::array<Shard, ShardCount> m_shards{}; ///< The shards of the counters.
+
+    EnumCounter() = default;
+    EnumCounter(const EnumCounter&) = delete;
+    EnumCounter& operator=(const EnumCounter&) = delete;
+
+    /**
+     * @brief Adds to the counter of an enum.
+     *
+     * @param key The counted enum.
+     * @param count The number of occurrences to add.
+     */
+    void increment(const key_type& key, count_type count = 1) noexcept
+    {
+        m_shards[this_thread_index() % ShardCount].m_counts[key.ordinal()].fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the counter of an enum, summed over the shards.
+     *
+     * The increments running concurrently may or may not be included.
+     *
+     * @param key The enum.
+     * @return The number of occurrences of the enum.
+     */
+    count_type count(const key_type& key) const noexcept
+    {
+        count_type result{0};
+        for (const auto& shard : m_shards)
+        {
+            result += shard.m_counts[key.ordinal()].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the counters of all the enums, summed over the shards.
+     *
+     * The increments running concurrently may or may not be included.
+     *
+     * @return The counters indexed by enum.
+     */
+    snapshot_type snapshot() const noexcept
+    {
+        snapshot_type result{};
+        for (const auto& shard : m_shards)
+        {
+            for (std::size_t ordinal{0}; ordinal < Holder::size(); ++ordinal)
+            {
+                result.m_values[ordinal] += shard.m_counts[ordinal].load(std::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Sets all the counters to zero.
+     *
+     * The increments running concurrently may or may not be cleared.
+     */
+    void reset() noexcept
+    {
+        for (auto& shard : m_shards)
+        {
+            for (auto& count : shard.m_counts)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+} // namespace trlc
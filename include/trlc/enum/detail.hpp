@@ -1,71 +1,244 @@
 #pragma once
 
-#include <algorithm>
+#include "trlc/constexpr_utils.hpp"
+#include "trlc/enum/macros.hpp"
+
+#include <array>
+#include <cassert>
+#include <charconv>
 #include <cstddef>
-#include <iostream>
+#include <cstdint>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 namespace trlc
 {
 
-// clang-format off
-#define TRLC_ENUM_NORMALIZE_HELPER() trlc::enum_feild::NormalizeHelper()
-
-#define TRLC_FIELD(...) TRLC_ENUM_NORMALIZE_HELPER() (TRLC_APPEND(TRLC_STRINGIFY, __delim__, __VA_ARGS__)) * size_t
-
-#define TRLC_ENUM_DECLARE_HELPER(varname, index) static constexpr enum_type varname{index - 1}
-
-#define TRLC_ENUM_DETAIL(enumname, enumdef, ...)                                                                                                              \
-    struct enumname                                                                                                                                           \
-    {                                                                                                                                                         \
-        using enum_def = enumdef<enumname>;                                                                                                                   \
-        using enum_type = enum_def::enum_type;                                                                                                                \
-        using value_type = enum_def::value_type;                                                                                                              \
-        using name_type = enum_def::enum_type::name_type;                                                                                                     \
-        using iterator_type = enum_def::iterator;                                                                                                             \
-        inline static constexpr std::string_view m_tag{#enumname};                                                                                            \
-        inline static constexpr auto m_values = trlc::enum_feild::array_values<enumname>({TRLC_EXPAND(TRLC_STRINGIFY, __VA_ARGS__)});                         \
-        inline static constexpr auto m_names = trlc::enum_feild::create_array_name({TRLC_EXPAND(TRLC_STRINGIFY, __VA_ARGS__)});                               \
-        inline static constexpr auto m_descs = trlc::enum_feild::create_array_description({TRLC_EXPAND(TRLC_STRINGIFY, __VA_ARGS__)});                        \
-        inline static constexpr auto m_size = m_values.size();                                                                                                \
-        inline static constexpr auto m_array = trlc::enum_feild::create_array_enum<enumname>();                                                               \
-        TRLC_APPLY_WITH_INDEX(TRLC_ENUM_DECLARE_HELPER, __VA_ARGS__)                                                                                          \
-        static constexpr trlc::EnumHelper<enum_def::holder, enum_def::value_search_policy, enum_def::name_search_policy, enum_def ::unknown_policy> helper{}; \
-        inline static constexpr iterator_type iterator{};                                                                                                     \
-        static constexpr std::optional<enum_type> fromValue(value_type value)                                                                                 \
-        {                                                                                                                                                     \
-            return helper.fromValue(value);                                                                                                                   \
-        }                                                                                                                                                     \
-        static constexpr std::optional<enum_type> fromString(const name_type& name)                                                                           \
-        {                                                                                                                                                     \
-            return helper.fromString(name);                                                                                                                   \
-        }                                                                                                                                                     \
-        static constexpr auto size()                                                                                                                          \
-        {                                                                                                                                                     \
-            return m_size;                                                                                                                                    \
-        }                                                                                                                                                     \
-        static constexpr auto tag()                                                                                                                           \
-        {                                                                                                                                                     \
-            return m_tag;                                                                                                                                     \
-        }                                                                                                                                                     \
-        static const std::string dump()                                                                                                                       \
-        {                                                                                                                                                     \
-            std::string result{};                                                                                                                             \
-            result += "[\n";                                                                                                                                  \
-            for (auto item : iterator)                                                                                                                        \
-            {                                                                                                                                                 \
-                result += " ";                                                                                                                                \
-                result += item.dump();                                                                                                                        \
-                result += ",\n";                                                                                                                              \
-            }                                                                                                                                                 \
-            result += "]";                                                                                                                                    \
-            return result;                                                                                                                                    \
-        }                                                                                                                                                     \
-    };
+/**
+ * @brief The number of enumerators of a Holder.
+ *
+ * Unlike Holder::m_size, it is usable while the Holder is still being defined, for example
+ * to select the type of the members of its enum_type. It is found by argument-dependent lookup
+ * of the friend declaration emitted by TRLC_ENUM_DETAIL.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+struct enum_count : decltype(trlcEnumCount(static_cast<Holder*>(nullptr)))
+{
+};
+
+template<class Holder>
+inline constexpr std::size_t enum_count_v = enum_count<Holder>::value;
+
+/**
+ * @brief The values of a Holder in ascending order, indexed by ordinal.
+ *
+ * The search policies read the values from this array rather than from Holder::m_array,
+ * whose elements also hold the names and descriptions.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto sorted_values = []()
+{
+    std::array<typename Holder::value_type, Holder::m_size> result{};
+    for (std::size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        result[ordinal] = Holder::m_values[Holder::m_order[ordinal]];
+    }
+    return result;
+}();
+
+/**
+ * @brief Computes the ordinal of an enum value in constant time.
+ *
+ * The ordinal is the position of the value in the ascending order of the Holder values. It is
+ * the distance to the smallest value when the values are contiguous, is read from the dense
+ * table of policy::DenseTableSearchPolicy when the values are dense, and is found with the
+ * perfect hash ordinal_hash otherwise. It is defined after the search policies.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param value The enum value.
+ * @return The ordinal of the value, or Holder::m_size if it is not one of the Holder values.
+ */
+template<class Holder, typename T>
+constexpr std::size_t ordinal_of(T value);
+
+/**
+ * @brief The names of a Holder in the ascending order of their values, indexed by ordinal.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto sorted_names = []()
+{
+    std::array<std::string_view, Holder::m_size> result{};
+    for (std::size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        result[ordinal] = Holder::m_names[Holder::m_order[ordinal]];
+    }
+    return result;
+}();
+
+/**
+ * @brief The ordinal of the enum standing for unknown inputs.
+ *
+ * It is the enumerator declared with TRLC_FIELD(unknown = true), or the first declared one.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @throws std::invalid_argument If more than one enumerator is declared unknown.
+ */
+template<class Holder>
+inline constexpr std::size_t unknown_ordinal = []()
+{
+    std::size_t result{0};
+    std::size_t count{0};
+    for (std::size_t index{0}; index < Holder::m_size; ++index)
+    {
+        if (Holder::m_fields[index].unknown)
+        {
+            result = index;
+            ++count;
+        }
+    }
+    if (count > 1)
+    {
+        throw std::invalid_argument("Only one enumerator can be unknown!");
+    }
+    return static_cast<std::size_t>(Holder::m_ordinals[result]);
+}();
+
+/**
+ * @brief Returns the exact size of the JSON dump of an enum.
+ *
+ * @param elem The enum, an Enum or a CompactEnum.
+ * @return The number of characters written by dump_enum_to.
+ */
+template<class E>
+constexpr std::size_t dump_enum_size(const E& elem)
+{
+    constexpr std::size_t FIXED_SIZE{std::string_view{"{\"tag\": \", \"value\": , \"name\": \"\", \"desc\": \"\"}"}.size()};
+    return FIXED_SIZE + elem.tag().size() + trlc::constexpr_utils::integer_size(elem.value()) + elem.name().size() + elem.desc().size();
+}
+
+/**
+ * @brief Writes the JSON dump of an enum to an output iterator, without allocation.
+ *
+ * @param elem The enum, an Enum or a CompactEnum.
+ * @param out The output iterator.
+ * @return The output iterator past the last written character.
+ */
+template<class E, class OutputIt>
+constexpr OutputIt dump_enum_to(const E& elem, OutputIt out)
+{
+    using trlc::constexpr_utils::write_string;
+    out = write_string("{\"tag\": \"", out);
+    out = write_string(elem.tag(), out);
+    out = write_string(", \"value\": ", out);
+    out = trlc::constexpr_utils::write_integer(elem.value(), out);
+    out = write_string(", \"name\": \"", out);
+    out = write_string(elem.name(), out);
+    out = write_string("\", \"desc\": \"", out);
+    out = write_string(elem.desc(), out);
+    return write_string("\"}", out);
+}
+
+/**
+ * @brief The exact size of the JSON dump of all the enums of a Holder, computed at compile time.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr std::size_t holder_dump_size = []()
+{
+    constexpr std::size_t ITEM_FIXED_SIZE{std::string_view{" ,\n"}.size()};
+    std::size_t result{std::string_view{"[\n]"}.size()};
+    for (const auto& elem : Holder::m_array)
+    {
+        result += ITEM_FIXED_SIZE + dump_enum_size(elem);
+    }
+    return result;
+}();
 
-// clang-format on
+/**
+ * @brief Writes the JSON dump of all the enums of a Holder to an output iterator, without allocation.
+ *
+ * @tparam Holder The holder class of the enum.
+ * @param out The output iterator.
+ * @return The output iterator past the last written character.
+ */
+template<class Holder, class OutputIt>
+constexpr OutputIt dump_holder_to(OutputIt out)
+{
+    using trlc::constexpr_utils::write_string;
+    out = write_string("[\n", out);
+    for (const auto& elem : Holder::m_array)
+    {
+        out = write_string(" ", out);
+        out = dump_enum_to(elem, out);
+        out = write_string(",\n", out);
+    }
+    return write_string("]", out);
+}
+
+/**
+ * @brief The JSON dump of all the enums of a Holder, written at compile time.
+ *
+ * The dump of every enum is a part of it, see holder_dump_offsets.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto holder_dump_chars = []()
+{
+    std::array<char, holder_dump_size<Holder>> result{};
+    dump_holder_to<Holder>(result.data());
+    return result;
+}();
+
+/**
+ * @brief The offset of the JSON dump of every enum of a Holder in holder_dump_chars, by ordinal.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto holder_dump_offsets = []()
+{
+    constexpr std::size_t ITEM_FIXED_SIZE{std::string_view{",\n "}.size()};
+    std::array<std::size_t, Holder::m_size> result{};
+    std::size_t offset{std::string_view{"[\n "}.size()};
+    for (std::size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        result[ordinal] = offset;
+        offset += dump_enum_size(Holder::m_array[ordinal]) + ITEM_FIXED_SIZE;
+    }
+    return result;
+}();
+
+/**
+ * @brief Writes a JSON dump into a character range, in the manner of std::to_chars.
+ *
+ * @param first The start of the range.
+ * @param last The end of the range.
+ * @param size The exact size of the dump.
+ * @param write Writes the dump to a char pointer and returns the pointer past the end.
+ * @return {first + size, std::errc{}} on success, {last, std::errc::value_too_large} if the range is too small.
+ */
+template<class Write>
+constexpr std::to_chars_result dump_to_chars(char* first, char* last, std::size_t size, Write write)
+{
+    if (static_cast<std::size_t>(last - first) < size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+    return {write(first), std::errc{}};
+}
 
 /**
  * @brief A generic enum class to hold enum value, name, and description.
@@ -79,6 +252,7 @@ struct Enum
     using value_type = T;               ///< The type of the enum value.
     using name_type = std::string_view; ///< The type for the enum name.
     using desc_type = std::string_view; ///< The type for the enum description.
+    using ordinal_type = trlc::constexpr_utils::smallest_unsigned_t<enum_count_v<Holder> - 1>; ///< The type of the enum ordinal.
 
     T m_value{};               ///< The enum value.
     std::string_view m_name{}; ///< The name of the enum.
@@ -142,6 +316,22 @@ struct Enum
         return m_desc;
     }
 
+    /**
+     * @brief Returns the ordinal of the enum.
+     *
+     * The ordinal is the position of the enum in the iteration order, from 0 to Holder::size() - 1.
+     * It is not stored but computed from the value by ordinal_of, so the value must be one of
+     * the Holder values, which is asserted in debug builds.
+     *
+     * @return The ordinal of the enum.
+     */
+    constexpr std::size_t ordinal() const
+    {
+        const std::size_t result{ordinal_of<Holder>(m_value)};
+        assert(result < Holder::m_size && "Value must be one of the enum values!");
+        return result;
+    }
+
     /**
      * @brief Compares two Enum objects for equality.
      *
@@ -203,197 +393,971 @@ struct Enum
     }
 
     /**
-     * @brief Returns a JSON-like string representation of the Enum.
+     * @brief Returns the exact size of the JSON dump of the Enum.
      *
-     * @return A string dump of the enum's data.
+     * @return The number of characters of dump().
      */
-    const std::string dump() const
+    constexpr std::size_t dumpSize() const
     {
-        using namespace std::literals;
-        return "{\"tag\": \""s + std::string{tag()} + ", \"value\": "s + std::to_string(static_cast<int>(m_value)) + ", \"name\": \""s + std::string{name()} + "\", \"desc\": \""s + std::string{desc()} + "\"}"s;
+        return dump_enum_size(*this);
     }
-};
 
-/**
- * @brief Helper class providing search functionality for enums.
- *
- * @tparam Holder A class that stores enum information.
- * @tparam EnumSearchPolicy Policy used for searching enums by value.
- * @tparam StringSearchPolicy Policy for searching enums by string.
- * @tparam UnknownPolicy Policy for handling unknown enum values.
- */
-template<typename Holder, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy>
-struct EnumHelper
-{
     /**
-     * @brief Searches for an enum by its value.
+     * @brief Writes the JSON dump of the Enum to an output iterator, without allocation.
      *
-     * @param value The enum value to search for.
-     * @return An std::optional containing the found enum or nullopt if not found.
+     * @param out The output iterator.
+     * @return The output iterator past the last written character.
      */
-    constexpr std::optional<typename Holder::enum_type> fromValue(typename Holder::value_type value) const
+    template<class OutputIt>
+    constexpr OutputIt dumpTo(OutputIt out) const
     {
-        std::optional<size_t> result{EnumSearchPolicy::template search<Holder>(value)};
-        if (result)
-        {
-            auto index{result.value()};
-            return Holder::m_array[index];
-        }
-        return UnknownPolicy::template handle<Holder>();
+        return dump_enum_to(*this, out);
     }
 
     /**
-     * @brief Searches for an enum by its name.
+     * @brief Writes the JSON dump of the Enum into a character range, without allocation.
      *
-     * @param name The name of the enum to search for.
-     * @return An std::optional containing the found enum or nullopt if not found.
+     * @param first The start of the range.
+     * @param last The end of the range.
+     * @return {ptr, ec} as std::to_chars, ec is std::errc::value_too_large if the range is smaller than dumpSize().
      */
-    constexpr std::optional<typename Holder::enum_type> fromString(std::string_view name) const
+    constexpr std::to_chars_result dumpTo(char* first, char* last) const
     {
-        std::optional<size_t> result{StringSearchPolicy::template search<Holder>(name)};
-        if (result)
+        return dump_to_chars(first, last, dumpSize(), [this](char* out)
+                             { return dumpTo(out); });
+    }
+
+    /**
+     * @brief Returns a JSON-like string representation of the Enum.
+     *
+     * The string is written at compile time, the call does no formatting. Only the enums of the
+     * Holder have one, use dumpString() or dumpTo() for an Enum built with a value, name or
+     * description of its own.
+     *
+     * @return A string dump of the enum's data.
+     * @throws std::invalid_argument If the Enum is not one of the Holder enums.
+     */
+    constexpr std::string_view dump() const
+    {
+        const std::size_t index{ordinal_of<Holder>(m_value)};
+        if (index >= Holder::m_size || sorted_names<Holder>[index] != m_name || Holder::m_descs[Holder::m_order[index]] != m_desc)
         {
-            auto index{result.value()};
-            return Holder::m_array[index];
+            throw std::invalid_argument("Only the Holder enums have a stored dump!");
         }
-        return UnknownPolicy::template handle<Holder>();
+        return std::string_view{holder_dump_chars<Holder>.data() + holder_dump_offsets<Holder>[index], dumpSize()};
+    }
+
+    /**
+     * @brief Returns a JSON-like string representation of any Enum, written at runtime.
+     *
+     * @return A string dump of the enum's data.
+     */
+    std::string dumpString() const
+    {
+        std::string result(dumpSize(), '\0');
+        dumpTo(result.data());
+        return result;
     }
 };
 
 /**
- * @brief Iterator class for Enum.
+ * @brief The names and descriptions of all the enums of a Holder, packed in one character buffer.
  *
- * @tparam Holder A class that holds the enum data.
+ * The strings are stored by ordinal, the name of an enum followed by its description. The
+ * offsets are stored in the smallest unsigned type able to index the buffer, so that a pool
+ * holds no pointer and needs no relocation.
+ *
+ * @tparam Size The number of characters of the pool.
+ * @tparam N The number of enums of the pool.
  */
-template<class Holder>
-struct EnumIterator
+template<std::size_t Size, std::size_t N>
+struct StringPool
 {
-    struct Iterator
-    {
-        std::size_t index{};
-
-        constexpr Iterator(std::size_t idx)
-            : index{idx}
-        {
-        }
+    using offset_type = trlc::constexpr_utils::smallest_unsigned_t<Size>; ///< The type of the offsets.
 
-        // Dereference operator
-        constexpr const typename Holder::enum_type operator*() const
-        {
-            return Holder::m_array[index];
-        }
-
-        // Pre-increment operator
-        constexpr Iterator& operator++()
-        {
-            ++index;
-            return *this;
-        }
-
-        // Comparison operators
-        constexpr bool operator!=(const Iterator& other) const
-        {
-            return index != other.index;
-        }
-        constexpr bool operator==(const Iterator& other) const
-        {
-            return index == other.index;
-        }
-    };
+    std::array<char, Size> m_chars{};               ///< The names and descriptions.
+    std::array<offset_type, 2 * N + 1> m_offsets{}; ///< The start of every string, followed by the end of the last one.
 
     /**
-     * @brief Returns an iterator to the beginning of the enum array.
+     * @brief Returns the name of an enum.
      *
-     * @return Iterator pointing to the start of the array.
+     * @param ordinal The ordinal of the enum.
+     * @return The name of the enum.
      */
-    constexpr Iterator begin() const
+    constexpr std::string_view name(std::size_t ordinal) const
     {
-        constexpr size_t START_INDEX{0};
-        return Iterator(START_INDEX);
+        return string(2 * ordinal);
     }
 
     /**
-     * @brief Returns an iterator to the end of the enum array.
+     * @brief Returns the description of an enum.
      *
-     * @return Iterator pointing past the last element.
+     * @param ordinal The ordinal of the enum.
+     * @return The description of the enum.
      */
-    constexpr Iterator end() const
+    constexpr std::string_view desc(std::size_t ordinal) const
     {
-        return Iterator(Holder::size());
+        return string(2 * ordinal + 1);
+    }
+
+private:
+    constexpr std::string_view string(std::size_t index) const
+    {
+        return std::string_view{m_chars.data() + m_offsets[index], static_cast<std::size_t>(m_offsets[index + 1] - m_offsets[index])};
     }
 };
 
+/**
+ * @brief The number of characters of the names and descriptions of a Holder.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr std::size_t string_pool_size = []()
+{
+    std::size_t result{0};
+    for (std::size_t index{0}; index < Holder::m_size; ++index)
+    {
+        result += Holder::m_names[index].size() + Holder::m_descs[index].size();
+    }
+    return result;
+}();
+
+/**
+ * @brief The names and descriptions of a Holder packed at compile time, see StringPool.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto string_pool = []()
+{
+    using pool_type = StringPool<string_pool_size<Holder>, Holder::m_size>;
+    using offset_type = typename pool_type::offset_type;
+    pool_type result{};
+    char* out{result.m_chars.data()};
+    for (std::size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        const std::size_t index{Holder::m_order[ordinal]};
+        result.m_offsets[2 * ordinal] = static_cast<offset_type>(out - result.m_chars.data());
+        out = trlc::constexpr_utils::write_string(Holder::m_names[index], out);
+        result.m_offsets[2 * ordinal + 1] = static_cast<offset_type>(out - result.m_chars.data());
+        out = trlc::constexpr_utils::write_string(Holder::m_descs[index], out);
+    }
+    result.m_offsets[2 * Holder::m_size] = static_cast<offset_type>(out - result.m_chars.data());
+    return result;
+}();
+
 namespace policy
 {
 
 /**
- * @brief Policy for linear searching of enum values.
+ * @brief Storage policy reading the names and descriptions from the Holder arrays.
  */
-struct LinearSearchPolicy
+struct ArrayStoragePolicy
 {
     /**
-     * @brief Performs a linear search for an enum value.
+     * @brief Returns the name of an enum.
      *
-     * @tparam Holder The holder class storing the enum values.
-     * @param value The enum value to search for.
-     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     * @tparam Holder The holder class of the enum.
+     * @param ordinal The ordinal of the enum.
+     * @return The name of the enum.
      */
     template<class Holder>
-    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    static constexpr std::string_view name(std::size_t ordinal)
     {
-        std::optional<size_t> found_index{};
-        for (size_t index{0}; index < Holder::m_values.size(); ++index)
-        {
+        return sorted_names<Holder>[ordinal];
+    }
 
-            if (Holder::m_values[index] == value)
-            {
-                found_index = index;
-                break;
-            }
-        }
-        return found_index;
+    /**
+     * @brief Returns the description of an enum.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @param ordinal The ordinal of the enum.
+     * @return The description of the enum.
+     */
+    template<class Holder>
+    static constexpr std::string_view desc(std::size_t ordinal)
+    {
+        return Holder::m_descs[Holder::m_order[ordinal]];
     }
 };
 
 /**
- * @brief Policy for binary searching of enum values.
+ * @brief Storage policy reading the names and descriptions from the string_pool of the Holder.
+ *
+ * Only the pool of the enum is emitted in the binary, instead of the string_view arrays of the Holder.
  */
-struct BinarySearchPolicy
+struct PooledStoragePolicy
 {
     /**
-     * @brief Performs a binary search for an enum value.
+     * @brief Returns the name of an enum.
      *
-     * @tparam Holder The holder class storing the enum values.
-     * @param value The enum value to search for.
-     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     * @tparam Holder The holder class of the enum.
+     * @param ordinal The ordinal of the enum.
+     * @return The name of the enum.
      */
     template<class Holder>
-    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    static constexpr std::string_view name(std::size_t ordinal)
     {
-        std::optional<size_t> found_index{};
-        // Perform binary search
-        size_t left = 0;
-        size_t right = Holder::m_array.size() - 1;
-
-        while (left <= right)
-        {
-            size_t mid = left + (right - left) / 2;
+        return string_pool<Holder>.name(ordinal);
+    }
 
-            if (Holder::m_array[mid].value() == value)
-            {
-                found_index = mid;
-                break;
-            }
-            if (Holder::m_array[mid].value() < value)
-            {
+    /**
+     * @brief Returns the description of an enum.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @param ordinal The ordinal of the enum.
+     * @return The description of the enum.
+     */
+    template<class Holder>
+    static constexpr std::string_view desc(std::size_t ordinal)
+    {
+        return string_pool<Holder>.desc(ordinal);
+    }
+};
+
+} // namespace policy
+
+/**
+ * @brief A compact enum class holding only the ordinal of the enum.
+ *
+ * It provides the same interface as Enum, but stores the position of the enum in the
+ * Holder array in the smallest unsigned type able to represent it, and reads the value,
+ * name and description from the Holder on demand, through the StoragePolicy.
+ * Select it through the enum_type of an EnumDef.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam Holder A class that provides access to arrays of enum values, names, and descriptions.
+ * @tparam StoragePolicy The storage of the names and descriptions, policy::ArrayStoragePolicy or policy::PooledStoragePolicy.
+ */
+template<typename T, class Holder, class StoragePolicy = policy::ArrayStoragePolicy>
+struct CompactEnum
+{
+    using value_type = T;                                                                 ///< The type of the enum value.
+    using name_type = std::string_view;                                                   ///< The type for the enum name.
+    using desc_type = std::string_view;                                                   ///< The type for the enum description.
+    using ordinal_type = trlc::constexpr_utils::smallest_unsigned_t<enum_count_v<Holder> - 1>; ///< The type of the enum ordinal.
+
+    ordinal_type m_ordinal{}; ///< The position of the enum in the Holder array.
+
+    constexpr CompactEnum() = default;
+
+    /**
+     * @brief Constructs a CompactEnum by its index.
+     *
+     * @param index The index of the enum in the Holder.
+     */
+    constexpr CompactEnum(size_t index)
+        : m_ordinal{static_cast<ordinal_type>(Holder::m_ordinals[index])}
+    {
+    }
+
+    /**
+     * @brief Constructs a CompactEnum with specified value, name, and description.
+     *
+     * The name and description are always read from the Holder.
+     *
+     * @param value The enum value.
+     * @throws std::invalid_argument If the value is not one of the Holder values.
+     */
+    constexpr CompactEnum(value_type value, const name_type&, const desc_type&)
+        : m_ordinal{static_cast<ordinal_type>(ordinal_of<Holder>(value))}
+    {
+        if (m_ordinal >= Holder::m_size || sorted_values<Holder>[m_ordinal] != value)
+        {
+            throw std::invalid_argument("Value must be one of the enum values!");
+        }
+    }
+
+    /**
+     * @brief Returns the value of the enum.
+     *
+     * @return The enum value.
+     */
+    constexpr T value() const
+    {
+        return sorted_values<Holder>[m_ordinal];
+    }
+
+    /**
+     * @brief Returns the name of the enum.
+     *
+     * @return The name of the enum.
+     */
+    constexpr std::string_view name() const
+    {
+        return StoragePolicy::template name<Holder>(m_ordinal);
+    }
+
+    /**
+     * @brief Returns the description of the enum.
+     *
+     * @return The description of the enum.
+     */
+    constexpr std::string_view desc() const
+    {
+        return StoragePolicy::template desc<Holder>(m_ordinal);
+    }
+
+    /**
+     * @brief Returns the ordinal of the enum.
+     *
+     * The ordinal is the position of the enum in the iteration order, from 0 to Holder::size() - 1.
+     *
+     * @return The ordinal of the enum.
+     */
+    constexpr std::size_t ordinal() const
+    {
+        return m_ordinal;
+    }
+
+    /**
+     * @brief Compares two CompactEnum objects for equality.
+     *
+     * @param other The other CompactEnum object to compare with.
+     * @return True if both CompactEnum objects have the same value; otherwise, false.
+     */
+    constexpr bool operator==(const CompactEnum& other) const
+    {
+        return m_ordinal == other.m_ordinal;
+    }
+
+    /**
+     * @brief Compares two CompactEnum objects for inequality.
+     *
+     * @param other The other CompactEnum object to compare with.
+     * @return True if the CompactEnum objects have different values; otherwise, false.
+     */
+    constexpr bool operator!=(const CompactEnum& other) const
+    {
+        return m_ordinal != other.m_ordinal;
+    }
+
+    /**
+     * @brief Conversion operator to the underlying type.
+     *
+     * @return The enum value.
+     */
+    constexpr operator T() const
+    {
+        return value();
+    }
+
+    /**
+     * @brief Returns the holder instance.
+     *
+     * @return A Holder instance.
+     */
+    constexpr Holder holder() const
+    {
+        return Holder{};
+    }
+
+    /**
+     * @brief Retrieves the tag associated with the CompactEnum's Holder.
+     *
+     * @return The tag of the Holder.
+     */
+    constexpr auto tag() const
+    {
+        return Holder::tag();
+    }
+
+    /**
+     * @brief Returns the exact size of the JSON dump of the CompactEnum.
+     *
+     * @return The number of characters of dump().
+     */
+    constexpr std::size_t dumpSize() const
+    {
+        return dump_enum_size(*this);
+    }
+
+    /**
+     * @brief Writes the JSON dump of the CompactEnum to an output iterator, without allocation.
+     *
+     * @param out The output iterator.
+     * @return The output iterator past the last written character.
+     */
+    template<class OutputIt>
+    constexpr OutputIt dumpTo(OutputIt out) const
+    {
+        return dump_enum_to(*this, out);
+    }
+
+    /**
+     * @brief Writes the JSON dump of the CompactEnum into a character range, without allocation.
+     *
+     * @param first The start of the range.
+     * @param last The end of the range.
+     * @return {ptr, ec} as std::to_chars, ec is std::errc::value_too_large if the range is smaller than dumpSize().
+     */
+    constexpr std::to_chars_result dumpTo(char* first, char* last) const
+    {
+        return dump_to_chars(first, last, dumpSize(), [this](char* out)
+                             { return dumpTo(out); });
+    }
+
+    /**
+     * @brief Returns a JSON-like string representation of the CompactEnum.
+     *
+     * The string is written at compile time, the call does no formatting. A CompactEnum is
+     * always an enum of the Holder, so its string is always the precomputed one.
+     *
+     * @return A string dump of the enum's data.
+     */
+    constexpr std::string_view dump() const
+    {
+        return std::string_view{holder_dump_chars<Holder>.data() + holder_dump_offsets<Holder>[ordinal()], dumpSize()};
+    }
+
+    /**
+     * @brief Returns a JSON-like string representation of the CompactEnum, as an owned string.
+     *
+     * @return A string dump of the enum's data.
+     */
+    std::string dumpString() const
+    {
+        return std::string{dump()};
+    }
+};
+
+/**
+ * @brief The result of fromChars, in the manner of std::from_chars_result.
+ *
+ * @tparam E The enum type.
+ */
+template<class E>
+struct FromCharsResult
+{
+    std::optional<E> value; ///< The matched enum, or nullopt if no name matches.
+    const char* ptr;        ///< The end of the matched name, the start of the buffer if no name matches.
+};
+
+namespace batch
+{
+
+/**
+ * @brief The batch conversions of the enums of a Holder, defined in trlc/enum/batch.hpp.
+ *
+ * The fromValues and fromStrings members of the enums call it, so they only compile once
+ * trlc/enum/batch.hpp is included.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+struct Converter;
+
+} // namespace batch
+
+/**
+ * @brief The prefix tree of the names of a Holder, keyed by ordinal.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto name_trie = []()
+{
+    constexpr std::size_t node_count{[]()
+                                     {
+                                         std::size_t result{1};
+                                         for (const auto& name : sorted_names<Holder>)
+                                         {
+                                             result += name.size();
+                                         }
+                                         return result;
+                                     }()};
+    return trlc::constexpr_utils::create_trie<node_count>(sorted_names<Holder>);
+}();
+
+/**
+ * @brief Detects whether an unknown policy takes the input that matched no enum, as handle<Holder>(input).
+ *
+ * @tparam Policy The unknown policy.
+ * @tparam Holder The holder class of the enum.
+ * @tparam Input The type of the input, the value type or std::string_view.
+ */
+template<class Policy, class Holder, class Input, class = void>
+struct handles_unknown_input : std::false_type
+{
+};
+
+template<class Policy, class Holder, class Input>
+struct handles_unknown_input<Policy, Holder, Input, std::void_t<decltype(Policy::template handle<Holder>(std::declval<Input>()))>> : std::true_type
+{
+};
+
+/**
+ * @brief Helper class providing search functionality for enums.
+ *
+ * @tparam Holder A class that stores enum information.
+ * @tparam EnumSearchPolicy Policy used for searching enums by value.
+ * @tparam StringSearchPolicy Policy for searching enums by string.
+ * @tparam UnknownPolicy Policy for handling unknown enum values.
+ */
+template<typename Holder, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy>
+struct EnumHelper
+{
+    /**
+     * @brief Searches for an enum by its value.
+     *
+     * @param value The enum value to search for.
+     * @return An std::optional containing the found enum or nullopt if not found.
+     */
+    constexpr std::optional<typename Holder::enum_type> fromValue(typename Holder::value_type value) const
+    {
+        std::optional<size_t> result{EnumSearchPolicy::template search<Holder>(value)};
+        if (result)
+        {
+            auto index{result.value()};
+            return Holder::m_array[index];
+        }
+        return handleUnknown(value);
+    }
+
+    /**
+     * @brief Searches for an enum by its name.
+     *
+     * @param name The name of the enum to search for.
+     * @return An std::optional containing the found enum or nullopt if not found.
+     */
+    constexpr std::optional<typename Holder::enum_type> fromString(std::string_view name) const
+    {
+        std::optional<size_t> result{StringSearchPolicy::template search<Holder>(name)};
+        if (result)
+        {
+            auto index{result.value()};
+            return Holder::m_array[index];
+        }
+        return handleUnknown(name);
+    }
+
+    /**
+     * @brief Searches for an enum by its value, without std::optional.
+     *
+     * The unknown policy is not called, a miss returns the fallback.
+     *
+     * @param value The enum value to search for.
+     * @param fallback The enum returned if no enum has the value.
+     * @return The found enum or the fallback.
+     */
+    constexpr typename Holder::enum_type fromValueOr(typename Holder::value_type value, const typename Holder::enum_type& fallback) const
+    {
+        const std::optional<size_t> result{EnumSearchPolicy::template search<Holder>(value)};
+        const auto& found{result ? Holder::m_array[*result] : fallback};
+        return found;
+    }
+
+    /**
+     * @brief Searches for an enum by its value, returning the unknown enum on a miss, see unknown_ordinal.
+     *
+     * @param value The enum value to search for.
+     * @return The found enum or the unknown enum.
+     */
+    constexpr typename Holder::enum_type fromValueOr(typename Holder::value_type value) const
+    {
+        return fromValueOr(value, Holder::m_array[unknown_ordinal<Holder>]);
+    }
+
+    /**
+     * @brief Searches for an enum by its name, without std::optional.
+     *
+     * The unknown policy is not called, a miss returns the fallback.
+     *
+     * @param name The name of the enum to search for.
+     * @param fallback The enum returned if no enum has the name.
+     * @return The found enum or the fallback.
+     */
+    constexpr typename Holder::enum_type fromStringOr(std::string_view name, const typename Holder::enum_type& fallback) const
+    {
+        const std::optional<size_t> result{StringSearchPolicy::template search<Holder>(name)};
+        const auto& found{result ? Holder::m_array[*result] : fallback};
+        return found;
+    }
+
+    /**
+     * @brief Searches for an enum by its name, returning the unknown enum on a miss, see unknown_ordinal.
+     *
+     * @param name The name of the enum to search for.
+     * @return The found enum or the unknown enum.
+     */
+    constexpr typename Holder::enum_type fromStringOr(std::string_view name) const
+    {
+        return fromStringOr(name, Holder::m_array[unknown_ordinal<Holder>]);
+    }
+
+    /**
+     * @brief Matches the longest enum name at the start of a buffer.
+     *
+     * The buffer does not need to be terminated or split into tokens, the names are matched
+     * with a compile-time prefix tree reading every byte at most once. The unknown policy is
+     * not called: a buffer starting with no name is reported by nullopt, so that a tokenizer
+     * never takes an enum that consumed no character, e.g. the default of DefaultOnUnknownPolicy.
+     *
+     * @param first The start of the buffer.
+     * @param last The end of the buffer.
+     * @return The found enum and the end of its name, or nullopt and first if no name matches.
+     */
+    constexpr FromCharsResult<typename Holder::enum_type> fromChars(const char* first, const char* last) const
+    {
+        const auto match{name_trie<Holder>.match(first, last)};
+        if (match.key != Holder::m_size)
+        {
+            return {Holder::m_array[match.key], match.last};
+        }
+        return {std::nullopt, first};
+    }
+
+private:
+    /**
+     * @brief Calls the unknown policy, with the input if it takes it.
+     *
+     * @param input The value or the name that matched no enum.
+     * @return What the unknown policy returns.
+     */
+    template<class Input>
+    static constexpr std::optional<typename Holder::enum_type> handleUnknown(Input input)
+    {
+        if constexpr (handles_unknown_input<UnknownPolicy, Holder, Input>::value)
+        {
+            return UnknownPolicy::template handle<Holder>(input);
+        }
+        else
+        {
+            return UnknownPolicy::template handle<Holder>();
+        }
+    }
+};
+
+/**
+ * @brief Iterator class for Enum.
+ *
+ * @tparam Holder A class that holds the enum data.
+ */
+template<class Holder>
+struct EnumIterator
+{
+    struct Iterator
+    {
+        std::size_t index{};
+
+        constexpr Iterator(std::size_t idx)
+            : index{idx}
+        {
+        }
+
+        // Dereference operator
+        constexpr const typename Holder::enum_type operator*() const
+        {
+            return Holder::m_array[index];
+        }
+
+        // Pre-increment operator
+        constexpr Iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        // Comparison operators
+        constexpr bool operator!=(const Iterator& other) const
+        {
+            return index != other.index;
+        }
+        constexpr bool operator==(const Iterator& other) const
+        {
+            return index == other.index;
+        }
+    };
+
+    /**
+     * @brief Returns an iterator to the beginning of the enum array.
+     *
+     * @return Iterator pointing to the start of the array.
+     */
+    constexpr Iterator begin() const
+    {
+        constexpr size_t START_INDEX{0};
+        return Iterator(START_INDEX);
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the enum array.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    constexpr Iterator end() const
+    {
+        return Iterator(Holder::size());
+    }
+};
+
+namespace policy
+{
+
+/**
+ * @brief Policy for linear searching of enum values.
+ *
+ * The values are read from the sorted values-only array sorted_values and every value is
+ * compared, without an early exit, counting the values below the searched one. The loop has
+ * no data-dependent branch and is vectorized by the compiler, so it suits small enums.
+ */
+struct LinearSearchPolicy
+{
+    /**
+     * @brief Performs a linear search for an enum value.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @param value The enum value to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        size_t index{0};
+        for (const auto& elem : sorted_values<Holder>)
+        {
+            index += static_cast<size_t>(elem < value);
+        }
+        if (index == Holder::m_size || sorted_values<Holder>[index] != value)
+        {
+            return std::nullopt;
+        }
+        return index;
+    }
+};
+
+/**
+ * @brief Policy for binary searching of enum values.
+ */
+struct BinarySearchPolicy
+{
+    /**
+     * @brief Performs a binary search for an enum value.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @param value The enum value to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        std::optional<size_t> found_index{};
+        // Perform binary search over [left, right)
+        size_t left = 0;
+        size_t right = Holder::m_size;
+
+        while (left < right)
+        {
+            size_t mid = left + (right - left) / 2;
+
+            if (sorted_values<Holder>[mid] == value)
+            {
+                found_index = mid;
+                break;
+            }
+            if (sorted_values<Holder>[mid] < value)
+            {
                 left = mid + 1;
             }
-            else
+            else
+            {
+                right = mid;
+            }
+        }
+        return found_index;
+    }
+};
+
+/**
+ * @brief Policy for branch-free searching of enum values in Eytzinger layout.
+ *
+ * The values are copied at compile time into a separate array in Eytzinger (breadth-first)
+ * order, so the search does not load the names and descriptions of Holder::m_array, the first
+ * levels of the tree share a few cache lines and the descendants a few levels down are
+ * contiguous and prefetched while the current level is compared. Every step is a comparison
+ * turned into an index, without a data-dependent branch. It suits large sparse enums.
+ */
+struct EytzingerSearchPolicy
+{
+    /**
+     * @brief The values in Eytzinger order.
+     *
+     * @tparam T The type of the enum values.
+     * @tparam N The number of values.
+     */
+    template<typename T, std::size_t N>
+    struct Table
+    {
+        using index_type = trlc::constexpr_utils::smallest_unsigned_t<N>;
+
+        std::array<T, N + 1> values{};            ///< The values, the root at 1 and the children of k at 2k and 2k + 1.
+        std::array<index_type, N + 1> indexes{}; ///< The index in the Holder array of every value.
+    };
+
+    /**
+     * @brief Fills the subtree rooted at a node from the sorted values, in order.
+     *
+     * @param table The table to fill.
+     * @param node The root of the subtree.
+     * @param next The index of the next sorted value to place.
+     */
+    template<class Holder, class TableType>
+    static constexpr void fill(TableType& table, std::size_t node, std::size_t& next)
+    {
+        if (node > Holder::m_size)
+        {
+            return;
+        }
+        fill<Holder>(table, 2 * node, next);
+        table.values[node] = sorted_values<Holder>[next];
+        table.indexes[node] = static_cast<typename TableType::index_type>(next);
+        ++next;
+        fill<Holder>(table, 2 * node + 1, next);
+    }
+
+    /**
+     * @brief Builds the Eytzinger table of the enum values.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @return The table of values in Eytzinger order.
+     */
+    template<class Holder>
+    static constexpr auto createTable()
+    {
+        Table<typename Holder::value_type, Holder::m_size> table{};
+        std::size_t next{0};
+        fill<Holder>(table, 1, next);
+        return table;
+    }
+
+    template<class Holder>
+    static constexpr auto m_table = createTable<Holder>();
+
+    /**
+     * @brief Performs a branch-free search for an enum value.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @param value The enum value to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        constexpr const auto& table{m_table<Holder>};
+        // The descendants log2(PER_LINE) levels down are contiguous and fill one cache line.
+        constexpr std::size_t PER_LINE{64 / sizeof(typename Holder::value_type) > 0 ? 64 / sizeof(typename Holder::value_type) : 1};
+
+        std::size_t node{1};
+        while (node <= Holder::m_size)
+        {
+            const std::size_t ahead{node * PER_LINE};
+            trlc::constexpr_utils::prefetch(table.values.data() + (ahead <= Holder::m_size ? ahead : 0));
+            node = 2 * node + static_cast<std::size_t>(table.values[node] < value);
+        }
+        // Drop the trailing right turns and the last left turn to find the lower bound.
+        node >>= trlc::constexpr_utils::countr_zero(~static_cast<std::uint64_t>(node)) + 1;
+        if (node == 0 || table.values[node] != value)
+        {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(table.indexes[node]);
+    }
+};
+
+/**
+ * @brief Policy for direct-indexed searching of enum values.
+ *
+ * Builds, at compile time, a table covering the range [min, max] of the enum values
+ * that maps each value to its index in the Holder array, with a sentinel for holes.
+ * A lookup is then one bounds check plus one load.
+ *
+ * The table is only built when the span of the values is at most MAX_SPAN_RATIO times
+ * the number of enumerators. Otherwise the policy falls back to BinarySearchPolicy,
+ * so it is always safe to select it for any enum.
+ */
+struct DenseTableSearchPolicy
+{
+    static constexpr std::uint64_t MAX_SPAN_RATIO{4}; ///< Maximum ratio between the value span and the enum size.
+
+    /**
+     * @brief Returns the distance between the largest and the smallest enum value.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @return The value max - min computed without overflow.
+     */
+    template<class Holder>
+    static constexpr std::uint64_t distance()
+    {
+        return static_cast<std::uint64_t>(sorted_values<Holder>[Holder::m_size - 1]) - static_cast<std::uint64_t>(sorted_values<Holder>[0]);
+    }
+
+    /**
+     * @brief Checks whether the enum values are dense enough to be direct-indexed.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @return True if the lookup table will be built; otherwise false.
+     */
+    template<class Holder>
+    static constexpr bool isDense()
+    {
+        return distance<Holder>() < static_cast<std::uint64_t>(Holder::m_size) * MAX_SPAN_RATIO;
+    }
+
+    /**
+     * @brief Builds the value to index lookup table.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @return An array indexed by value - min holding the index in the Holder array or Holder::m_size for holes.
+     */
+    template<class Holder>
+    static constexpr auto createTable()
+    {
+        using index_type = trlc::constexpr_utils::smallest_unsigned_t<Holder::m_size>;
+        constexpr std::size_t table_size{isDense<Holder>() ? static_cast<std::size_t>(distance<Holder>() + 1) : 1};
+
+        std::array<index_type, table_size> table{};
+        for (size_t offset{0}; offset < table_size; ++offset)
+        {
+            table[offset] = static_cast<index_type>(Holder::m_size);
+        }
+        if constexpr (isDense<Holder>())
+        {
+            const auto min{static_cast<std::uint64_t>(sorted_values<Holder>[0])};
+            for (size_t index{0}; index < Holder::m_size; ++index)
+            {
+                table[static_cast<std::uint64_t>(sorted_values<Holder>[index]) - min] = static_cast<index_type>(index);
+            }
+        }
+        return table;
+    }
+
+    template<class Holder>
+    static constexpr auto m_table = createTable<Holder>();
+
+    /**
+     * @brief Performs a direct-indexed search for an enum value.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @param value The enum value to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        if constexpr (!isDense<Holder>())
+        {
+            return BinarySearchPolicy::search<Holder>(value);
+        }
+        else
+        {
+            const std::uint64_t offset{static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(sorted_values<Holder>[0])};
+            if (offset >= m_table<Holder>.size() || m_table<Holder>[offset] == Holder::m_size)
             {
-                right = mid - 1;
+                return std::nullopt;
             }
+            return static_cast<size_t>(m_table<Holder>[offset]);
         }
-        return found_index;
     }
 };
 
@@ -413,10 +1377,10 @@ struct CaseSensitiveStringSearchPolicy
     static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
     {
         std::optional<size_t> found_index{};
-        for (size_t index{0}; index < Holder::m_array.size(); ++index)
+        for (size_t index{0}; index < Holder::m_size; ++index)
         {
 
-            if (Holder::m_array[index].name() == name)
+            if (sorted_names<Holder>[index] == name)
             {
                 found_index = index;
                 break;
@@ -428,28 +1392,185 @@ struct CaseSensitiveStringSearchPolicy
 };
 
 /**
- * @brief Policy for case-insensitive string searching of enum names.
+ * @brief Policy for case-sensitive string searching of enum names through a perfect hash.
+ *
+ * A collision-free hash table over the enum names is built at compile time, so a lookup
+ * costs one hash of the input, one table probe and one final string comparison.
  */
-struct CaseInsensitiveStringSearchPolicy
+struct PerfectHashStringSearchPolicy
+{
+    /**
+     * @brief Builds the perfect hash table over the enum names.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @return The perfect hash table mapping a name hash to its index in the Holder array.
+     */
+    template<class Holder>
+    static constexpr auto createTable()
+    {
+        std::array<std::uint64_t, Holder::m_size> hashes{};
+        for (size_t index{0}; index < Holder::m_size; ++index)
+        {
+            hashes[index] = trlc::constexpr_utils::hash(sorted_names<Holder>[index]);
+        }
+        return trlc::constexpr_utils::create_perfect_hash(hashes);
+    }
+
+    template<class Holder>
+    static constexpr auto m_table = createTable<Holder>();
+
+    /**
+     * @brief Performs a case-sensitive hashed search for an enum name.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @param name The name to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
+    {
+        const size_t index{m_table<Holder>.find(trlc::constexpr_utils::hash(name))};
+        if (index == Holder::m_size || sorted_names<Holder>[index] != name)
+        {
+            return std::nullopt;
+        }
+        return index;
+    }
+};
+
+/**
+ * @brief Policy for case-sensitive string searching of enum names grouped by length.
+ *
+ * The enum names are grouped by length at compile time along with their first 8 bytes
+ * loaded as a single integer, so a lookup only visits the names of the input length,
+ * rejects most of them with one integer comparison and compares the rest of a name
+ * 8 bytes at a time. It needs no hashing, which suits small enums.
+ */
+struct LengthBucketedStringSearchPolicy
 {
     /**
-     * @brief Compares two characters case-insensitively.
+     * @brief The names grouped by length.
+     *
+     * @tparam MaxLength The length of the longest name.
+     * @tparam N The number of names.
+     */
+    template<std::size_t MaxLength, std::size_t N>
+    struct Table
+    {
+        using index_type = trlc::constexpr_utils::smallest_unsigned_t<N>;
+
+        std::array<index_type, MaxLength + 2> starts{}; ///< The names of length l are at [starts[l], starts[l + 1]).
+        std::array<std::uint64_t, N> prefixes{};        ///< The first 8 bytes of every name, see prefix().
+        std::array<index_type, N> indexes{};            ///< The index in the Holder array of every name.
+    };
+
+    /**
+     * @brief Loads the first 8 bytes of a name, or all of its bytes if it is shorter.
+     *
+     * @param data The name.
+     * @param size The size of the name, at least 1.
+     * @return The loaded bytes.
+     */
+    static constexpr std::uint64_t prefix(const char* data, std::size_t size)
+    {
+        return size >= 8 ? trlc::constexpr_utils::load_u64(data) : trlc::constexpr_utils::load_last_u64(data, size);
+    }
+
+    /**
+     * @brief Returns the length of the longest enum name.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @return The length of the longest name.
+     */
+    template<class Holder>
+    static constexpr std::size_t maxLength()
+    {
+        std::size_t result{0};
+        for (size_t index{0}; index < Holder::m_size; ++index)
+        {
+            result = sorted_names<Holder>[index].size() > result ? sorted_names<Holder>[index].size() : result;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Groups the enum names by length.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @return The table of names grouped by length.
+     */
+    template<class Holder>
+    static constexpr auto createTable()
+    {
+        using table_type = Table<maxLength<Holder>(), Holder::m_size>;
+        using index_type = typename table_type::index_type;
+
+        table_type table{};
+        for (size_t index{0}; index < Holder::m_size; ++index)
+        {
+            ++table.starts[sorted_names<Holder>[index].size() + 1];
+        }
+        for (size_t length{1}; length < table.starts.size(); ++length)
+        {
+            table.starts[length] = static_cast<index_type>(table.starts[length] + table.starts[length - 1]);
+        }
+        std::array<std::size_t, maxLength<Holder>() + 1> cursors{};
+        for (size_t index{0}; index < Holder::m_size; ++index)
+        {
+            const auto name{sorted_names<Holder>[index]};
+            const std::size_t position{table.starts[name.size()] + cursors[name.size()]++};
+            table.prefixes[position] = prefix(name.data(), name.size());
+            table.indexes[position] = static_cast<index_type>(index);
+        }
+        return table;
+    }
+
+    template<class Holder>
+    static constexpr auto m_table = createTable<Holder>();
+
+    /**
+     * @brief Performs a case-sensitive search for an enum name among the names of the same length.
      *
-     * @param a The first character.
-     * @param b The second character.
-     * @return True if the characters are equal ignoring case; otherwise false.
+     * @tparam Holder The holder class storing the enum names.
+     * @param name The name to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
      */
-    static constexpr bool caseInsensitiveEqual(char a, char b)
+    template<class Holder>
+    static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
     {
-#if __cplusplus >= 202002L
-// C++20 or later: use std::tolower as it is constexpr
-#include <cctype>
-        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
-#else
-        return toLower(static_cast<unsigned char>(a)) == toLower(static_cast<unsigned char>(b));
-#endif
+        constexpr const auto& table{m_table<Holder>};
+        if (name.size() > maxLength<Holder>())
+        {
+            return std::nullopt;
+        }
+        const std::size_t first{table.starts[name.size()]};
+        const std::size_t last{table.starts[name.size() + 1]};
+        if (first == last)
+        {
+            return std::nullopt;
+        }
+        const std::uint64_t input_prefix{prefix(name.data(), name.size())};
+        for (std::size_t position{first}; position < last; ++position)
+        {
+            if (table.prefixes[position] != input_prefix)
+            {
+                continue;
+            }
+            const std::size_t index{table.indexes[position]};
+            if (name.size() <= 8 || trlc::constexpr_utils::equal_bytes(name.data() + 8, sorted_names<Holder>[index].data() + 8, name.size() - 8))
+            {
+                return index;
+            }
+        }
+        return std::nullopt;
     }
+};
 
+/**
+ * @brief Policy for case-insensitive string searching of enum names.
+ */
+struct CaseInsensitiveStringSearchPolicy
+{
     /**
      * @brief Performs a case-insensitive search for an enum name.
      *
@@ -461,10 +1582,10 @@ struct CaseInsensitiveStringSearchPolicy
     static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
     {
         std::optional<size_t> found_index{};
-        for (size_t index{0}; index < Holder::m_array.size(); ++index)
+        for (size_t index{0}; index < Holder::m_size; ++index)
         {
 
-            if (name.size() == Holder::m_array[index].name().size() && std::equal(Holder::m_array[index].name().begin(), Holder::m_array[index].name().end(), name.begin(), caseInsensitiveEqual))
+            if (trlc::constexpr_utils::equal_ignore_case(sorted_names<Holder>[index], name))
             {
                 found_index = index;
                 break;
@@ -473,16 +1594,114 @@ struct CaseInsensitiveStringSearchPolicy
 
         return found_index;
     }
+};
+
+/**
+ * @brief Policy for case-insensitive string searching of enum names through a perfect hash.
+ *
+ * The names are folded to lower case and hashed into a collision-free table at compile time.
+ * A lookup folds and hashes the input 8 bytes per step, probes the table once and verifies
+ * the single candidate, so a miss no longer compares the input against every name.
+ * Only ASCII letters are folded, as in CaseInsensitiveStringSearchPolicy.
+ */
+struct CaseInsensitivePerfectHashStringSearchPolicy
+{
+    /**
+     * @brief Builds the perfect hash table over the folded enum names.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @return The perfect hash table mapping a folded name hash to its index in the Holder array.
+     * @throws std::invalid_argument If two names differ only in case, since their folded hashes are equal.
+     */
+    template<class Holder>
+    static constexpr auto createTable()
+    {
+        std::array<std::uint64_t, Holder::m_size> hashes{};
+        for (size_t index{0}; index < Holder::m_size; ++index)
+        {
+            hashes[index] = trlc::constexpr_utils::hash<true>(sorted_names<Holder>[index]);
+        }
+        return trlc::constexpr_utils::create_perfect_hash(hashes);
+    }
+
+    template<class Holder>
+    static constexpr auto m_table = createTable<Holder>();
+
+    /**
+     * @brief Performs a case-insensitive hashed search for an enum name.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     * @param name The name to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
+    {
+        const size_t index{m_table<Holder>.find(trlc::constexpr_utils::hash<true>(name))};
+        if (index == Holder::m_size || !trlc::constexpr_utils::equal_ignore_case(sorted_names<Holder>[index], name))
+        {
+            return std::nullopt;
+        }
+        return index;
+    }
+};
+
+/**
+ * @brief Policy selecting the search of enum values and names from the enum at compile time.
+ *
+ * It can be used both as value_search_policy and as name_search_policy. The values are searched
+ * with DenseTableSearchPolicy when they are dense, with LinearSearchPolicy when there are at most
+ * MAX_LINEAR_VALUES of them and with EytzingerSearchPolicy otherwise. The names are searched with
+ * CaseSensitiveStringSearchPolicy when there are at most MAX_LINEAR_NAMES of them and with
+ * PerfectHashStringSearchPolicy otherwise. The selected policies are reported by trlc::enum_traits.
+ */
+struct AutoSearchPolicy
+{
+    static constexpr std::size_t MAX_LINEAR_VALUES{8}; ///< Maximum number of values searched linearly.
+    static constexpr std::size_t MAX_LINEAR_NAMES{16}; ///< Maximum number of names searched linearly.
+
+    /**
+     * @brief The policy selected to search the values of a Holder.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     */
+    template<class Holder>
+    using value_policy = std::conditional_t<DenseTableSearchPolicy::isDense<Holder>(),
+                                            DenseTableSearchPolicy,
+                                            std::conditional_t<(Holder::m_size <= MAX_LINEAR_VALUES), LinearSearchPolicy, EytzingerSearchPolicy>>;
+
+    /**
+     * @brief The policy selected to search the names of a Holder.
+     *
+     * @tparam Holder The holder class storing the enum names.
+     */
+    template<class Holder>
+    using name_policy = std::conditional_t<(Holder::m_size <= MAX_LINEAR_NAMES), CaseSensitiveStringSearchPolicy, PerfectHashStringSearchPolicy>;
+
+    /**
+     * @brief Searches for an enum value with the selected value policy.
+     *
+     * @tparam Holder The holder class storing the enum values.
+     * @param value The enum value to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        return value_policy<Holder>::template search<Holder>(value);
+    }
 
     /**
-     * @brief Converts a single character to lowercase for case-insensitive comparison.
+     * @brief Searches for an enum name with the selected name policy.
      *
-     * @param ch The character to convert to lowercase.
-     * @return The lowercase equivalent if the input is an uppercase letter; otherwise, returns the character unchanged.
+     * @tparam Holder The holder class storing the enum names.
+     * @param name The name to search for.
+     * @return An std::optional containing the index of the found enum or nullopt if not found.
      */
-    static constexpr char toLower(char ch)
+    template<class Holder>
+    static constexpr std::optional<size_t> search(const typename Holder::name_type& name)
     {
-        return (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+        return name_policy<Holder>::template search<Holder>(name);
     }
 };
 
@@ -503,6 +1722,121 @@ struct UnknownPolicy
         return std::nullopt;
     }
 };
+
+/**
+ * @brief Policy for handling unknown enum values by returning a designated enum.
+ *
+ * The enum is the one declared with TRLC_FIELD(unknown = true), or the first declared one,
+ * see unknown_ordinal. fromValue and fromString then always return an enum.
+ */
+struct DefaultOnUnknownPolicy
+{
+    /**
+     * @brief Handles unknown enums by returning the unknown enum.
+     *
+     * @tparam Holder The holder class storing the enum data.
+     * @return An std::optional containing the unknown enum.
+     */
+    template<class Holder>
+    static constexpr std::optional<typename Holder::enum_type> handle()
+    {
+        return Holder::m_array[unknown_ordinal<Holder>];
+    }
+};
 } // namespace policy
 
+/**
+ * @brief The perfect hash mapping the mixed values of a Holder to their ordinal.
+ *
+ * Since constexpr_utils::mix is a bijection, distinct values always have distinct hashes.
+ *
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Holder>
+inline constexpr auto ordinal_hash = []()
+{
+    std::array<std::uint64_t, Holder::m_size> hashes{};
+    for (std::size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        hashes[ordinal] = trlc::constexpr_utils::mix(static_cast<std::uint64_t>(sorted_values<Holder>[ordinal]));
+    }
+    return trlc::constexpr_utils::create_perfect_hash(hashes);
+}();
+
+template<class Holder, typename T>
+constexpr std::size_t ordinal_of(T value)
+{
+    using dense_policy = policy::DenseTableSearchPolicy;
+    const std::uint64_t offset{static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(sorted_values<Holder>[0])};
+    if constexpr (dense_policy::distance<Holder>() == Holder::m_size - 1)
+    {
+        return offset < Holder::m_size ? static_cast<std::size_t>(offset) : Holder::m_size;
+    }
+    else if constexpr (dense_policy::isDense<Holder>())
+    {
+        return offset < dense_policy::m_table<Holder>.size() ? static_cast<std::size_t>(dense_policy::m_table<Holder>[offset]) : Holder::m_size;
+    }
+    else
+    {
+        const std::size_t ordinal{ordinal_hash<Holder>.find(trlc::constexpr_utils::mix(static_cast<std::uint64_t>(value)))};
+        return ordinal < Holder::m_size && sorted_values<Holder>[ordinal] == value ? ordinal : Holder::m_size;
+    }
+}
+
+/**
+ * @brief Resolves the policy actually used to search the values of a Holder.
+ *
+ * @tparam Policy The value_search_policy of the Holder.
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Policy, class Holder>
+struct selected_value_policy
+{
+    using type = Policy;
+};
+
+template<class Holder>
+struct selected_value_policy<policy::AutoSearchPolicy, Holder>
+{
+    using type = policy::AutoSearchPolicy::value_policy<Holder>;
+};
+
+/**
+ * @brief Resolves the policy actually used to search the names of a Holder.
+ *
+ * @tparam Policy The name_search_policy of the Holder.
+ * @tparam Holder The holder class of the enum.
+ */
+template<class Policy, class Holder>
+struct selected_name_policy
+{
+    using type = Policy;
+};
+
+template<class Holder>
+struct selected_name_policy<policy::AutoSearchPolicy, Holder>
+{
+    using type = policy::AutoSearchPolicy::name_policy<Holder>;
+};
+
+/**
+ * @brief Compile-time properties of an enum and the search policies it uses.
+ *
+ * @tparam Holder The holder class of the enum, e.g. the name given to TRLC_ENUM.
+ */
+template<class Holder>
+struct enum_traits
+{
+    using holder = Holder;
+    using value_type = typename Holder::value_type;
+    using value_search_policy = typename selected_value_policy<typename Holder::enum_def::value_search_policy, Holder>::type; ///< The policy used by fromValue.
+    using name_search_policy = typename selected_name_policy<typename Holder::enum_def::name_search_policy, Holder>::type;    ///< The policy used by fromString.
+
+    static constexpr std::size_t size{Holder::m_size};                                                        ///< The number of enumerators.
+    static constexpr value_type min{sorted_values<Holder>[0]};                                                ///< The smallest value.
+    static constexpr value_type max{sorted_values<Holder>[Holder::m_size - 1]};                               ///< The largest value.
+    static constexpr bool is_contiguous{policy::DenseTableSearchPolicy::distance<Holder>() + 1 == Holder::m_size}; ///< Whether the values are exactly [min, max].
+    static constexpr bool is_dense{policy::DenseTableSearchPolicy::isDense<Holder>()};                         ///< Whether the values fit a direct-indexed table.
+};
+
 } // namespace trlc
\ No newline at end of file
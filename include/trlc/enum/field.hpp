@@ -163,216 +163,262 @@ constexpr std::optional<std::string_view> trlc_field_desc(std::string_view input
 }
 
 /**
- * @brief Searches for a given value in a constexpr std::array.
+ * @brief Checks whether the unknown field of the input string is true.
  *
- * This function performs a linear search on the provided `std::array`
- * and returns true if the value is found, or false otherwise.
+ * The fields are split at the delimiters, so that a description containing the word
+ * does not match.
  *
- * @tparam T The type of the array elements.
- * @tparam N The size of the array.
- * @param arr The `std::array` to search.
- * @param value The value to find within the array.
- * @return constexpr bool True if the value is found, false otherwise.
+ * @param input The input string_view containing field information.
+ * @return True if a field reads unknown = true; otherwise, false.
  */
-template<typename T, std::size_t N>
-constexpr bool find_value(const std::array<T, N>& arr, const T value)
+constexpr bool trlc_field_unknown(std::string_view input)
 {
-    for (std::size_t i = 0; i < N; ++i)
+    constexpr std::string_view delim{"__delim__"};
+    constexpr std::string_view field{"unknown"};
+    constexpr std::string_view expected{"true"};
+
+    auto start = input.find("(\"");
+    if (start == std::string_view::npos)
+    {
+        return false;
+    }
+    start += 2;
+    while (start < input.size())
     {
-        if (arr[i] == value)
+        auto end = input.find(delim, start);
+        const std::string_view item{input.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start)};
+        const auto field_pos = item.find_first_not_of(' ');
+        if (field_pos != std::string_view::npos && item.substr(field_pos, field.size()) == field)
         {
-            return true;
+            const auto equal_pos = item.find_first_not_of(' ', field_pos + field.size());
+            if (equal_pos != std::string_view::npos && item[equal_pos] == '=')
+            {
+                const auto value_pos = item.find_first_not_of(' ', equal_pos + 1);
+                return value_pos != std::string_view::npos && item.substr(value_pos, expected.size()) == expected;
+            }
+        }
+        if (end == std::string_view::npos)
+        {
+            break;
         }
+        start = end + delim.size();
     }
     return false;
 }
 
 /**
- * @brief Creates an array of indices based on input parameters for specific values.
+ * @brief The fields of an enumerator parsed from its stringified declaration.
+ */
+struct Field
+{
+    std::string_view name{};                 ///< The name of the enumerator.
+    std::optional<std::string_view> value{}; ///< The text of the value field, nullopt if the value is implicit.
+    std::string_view desc{};                 ///< The description, empty if there is none.
+    bool unknown{};                          ///< Whether the enumerator is returned for unknown inputs.
+};
+
+/**
+ * @brief Parses the name, value and description of every enumerator.
  *
- * This function looks for occurrences of "NormalizeHelper" in the provided arguments,
- * fetching their default values and returning the constructed indices.
+ * Every declaration is scanned once here, the arrays of the Holder are then built from the fields.
  *
- * @tparam TrLc enum Holder class
  * @tparam N The number of elements in the args array.
- * @param args An array of const character pointers.
- * @return An array of Holder::value_type representing the constructed indices.
- * @throws std::invalid_argument If any default values are invalid.
+ * @param args An array of const character pointers, the stringified declarations.
+ * @return An array of Field in declaration order.
  */
-template<class Holder, size_t N>
-constexpr auto array_values(const char* const (&args)[N])
+template<size_t N>
+constexpr auto parse_fields(const char* const (&args)[N])
 {
-    std::array<typename Holder::value_type, N> indices{};
-    std::array<typename Holder::value_type, N> specific_values{};
-    constexpr auto maximum_value{std::numeric_limits<typename Holder::value_type>::max()};
-    constexpr auto minimum_value{std::numeric_limits<typename Holder::value_type>::min()};
+    std::array<Field, N> fields{};
     for (size_t index{0}; index < N; ++index)
     {
-        indices[index] = maximum_value;
-        specific_values[index] = maximum_value;
+        const std::string_view arg{args[index]};
+        if (!trlc::constexpr_utils::contains(arg, "NormalizeHelper"))
+        {
+            fields[index].name = arg;
+            continue;
+        }
+
+        std::string_view name = before_equal(arg);
+
+        size_t start = name.find_first_not_of(" ");
+        size_t end = name.find_last_not_of(" ");
+
+        fields[index].name = name.substr(start, end - start + 1);
+        fields[index].value = trlc::enum_feild::trlc_field_value(arg);
+        fields[index].desc = trlc::enum_feild::trlc_field_desc(arg).value_or(std::string_view{});
+        fields[index].unknown = trlc::enum_feild::trlc_field_unknown(arg);
     }
+    return fields;
+}
+
+/**
+ * @brief Creates the array of the enum values from the parsed fields.
+ *
+ * The specific values are sorted to detect duplicates in O(N log N). The enumerators without a
+ * value field then take, in declaration order, the next values counting from 0 that are not
+ * specific values, found by walking the sorted specific values alongside.
+ *
+ * @tparam TrLc enum Holder class
+ * @tparam N The number of enumerators.
+ * @param fields The parsed fields of the enumerators.
+ * @return An array of Holder::value_type in declaration order.
+ * @throws std::invalid_argument If a value is invalid, overflows Holder::value_type or is not unique.
+ */
+template<class Holder, size_t N>
+constexpr auto array_values(const std::array<Field, N>& fields)
+{
+    using value_type = typename Holder::value_type;
+
+    std::array<value_type, N> values{};
+    std::array<value_type, N> specific_values{};
+    std::size_t specific_count{0};
+    constexpr auto maximum_value{std::numeric_limits<value_type>::max()};
+    constexpr auto minimum_value{std::numeric_limits<value_type>::min()};
     for (size_t index{0}; index < N; ++index)
     {
-        if (trlc::constexpr_utils::contains(args[index], "NormalizeHelper"))
+        if (!fields[index].value)
         {
-            const auto default_value_str{trlc::enum_feild::trlc_field_value(args[index])};
-            if (!default_value_str)
-            {
-                continue;
-            }
-
-            const auto raw_default_value{trlc::constexpr_utils::stoi(default_value_str.value())};
-            if (!raw_default_value)
-            {
-                throw std::invalid_argument("Invalid value!");
-            }
+            continue;
+        }
 
-            const auto default_value{raw_default_value.value()};
-            if (default_value < minimum_value || default_value > maximum_value)
-            {
-                throw std::invalid_argument("Value overflow with current enum value type!");
-            }
+        const auto raw_value{trlc::constexpr_utils::stoi(fields[index].value.value())};
+        if (!raw_value)
+        {
+            throw std::invalid_argument("Invalid value!");
+        }
 
-            indices[index] = default_value;
+        const auto value{raw_value.value()};
+        if (value < minimum_value || value > maximum_value)
+        {
+            throw std::invalid_argument("Value overflow with current enum value type!");
         }
+
+        values[index] = static_cast<value_type>(value);
+        specific_values[specific_count++] = static_cast<value_type>(value);
     }
 
-    if (!trlc::constexpr_utils::has_unique_elements(specific_values))
+    trlc::constexpr_utils::sort(specific_values.begin(), specific_values.begin() + specific_count);
+    for (size_t index{1}; index < specific_count; ++index)
     {
-        throw std::invalid_argument("Value must be unique!");
+        if (specific_values[index - 1] == specific_values[index])
+        {
+            throw std::invalid_argument("Value must be unique!");
+        }
     }
 
-    typename Holder::value_type current{0};
-
+    value_type current{0};
+    size_t next_specific{0};
     for (size_t index{0}; index < N; ++index)
     {
-        if (indices[index] == maximum_value)
+        if (fields[index].value)
+        {
+            continue;
+        }
+        while (next_specific < specific_count && specific_values[next_specific] <= current)
         {
-            for (size_t loop{0}; loop < N; ++loop)
+            if (specific_values[next_specific] == current)
             {
-                if (find_value(specific_values, current))
-                {
-                    current++;
-                    continue;
-                }
-                break;
+                current++;
             }
-            indices[index] = current;
-            current++;
+            ++next_specific;
         }
+        values[index] = current;
+        current++;
     }
-    return indices;
+    return values;
 }
 
 /**
- * @brief Extracts names from an array of input character pointers.
- *
- * This function retrieves the name associated with "NormalizeHelper"
- * from the input arguments, trimming whitespace as needed.
+ * @brief Extracts the names from the parsed fields.
  *
- * @tparam N The number of elements in the args array.
- * @param args An array of const character pointers.
- * @return An array of string_view representing the extracted names.
+ * @tparam N The number of enumerators.
+ * @param fields The parsed fields of the enumerators.
+ * @return An array of string_view representing the names.
  */
 template<size_t N>
-constexpr auto create_array_name(const char* const (&args)[N])
+constexpr auto create_array_name(const std::array<Field, N>& fields)
 {
     std::array<std::string_view, N> names{};
     for (size_t index{0}; index < N; ++index)
     {
-        if (trlc::constexpr_utils::contains(args[index], "NormalizeHelper"))
-        {
-            std::string_view name = before_equal(args[index]);
-
-            size_t start = name.find_first_not_of(" ");
-            size_t end = name.find_last_not_of(" ");
-
-            names[index] = name.substr(start, end - start + 1);
-            continue;
-        }
-        names[index] = args[index];
+        names[index] = fields[index].name;
     }
-
     return names;
 }
 
 /**
- * @brief Extracts descriptions from an array of input character pointers.
- *
- * This function retrieves the description associated with "NormalizeHelper"
- * from the input arguments, returning empty views where no description is found.
+ * @brief Extracts the descriptions from the parsed fields.
  *
- * @tparam N The number of elements in the args array.
- * @param args An array of const character pointers.
- * @return An array of string_view representing the extracted descriptions.
+ * @tparam N The number of enumerators.
+ * @param fields The parsed fields of the enumerators.
+ * @return An array of string_view representing the descriptions, empty where no description is found.
  */
 template<size_t N>
-constexpr auto create_array_description(const char* const (&args)[N])
+constexpr auto create_array_description(const std::array<Field, N>& fields)
 {
     std::array<std::string_view, N> descriptions{};
     for (size_t index{0}; index < N; ++index)
     {
-        if (trlc::constexpr_utils::contains(args[index], "NormalizeHelper"))
-        {
-            const auto description_str{trlc::enum_feild::trlc_field_desc(args[index])};
-            if (description_str)
-            {
-                descriptions[index] = description_str.value();
-                continue;
-            }
-        }
-        descriptions[index] = std::string_view{};
+        descriptions[index] = fields[index].desc;
     }
-
     return descriptions;
 }
 
 /**
- * @brief Finds the index of the next minimum value in the array that is greater than the given minimum.
+ * @brief Creates the order of the enum values.
+ *
+ * The position of an enum in the ascending order of the values is its ordinal. The declaration
+ * indexes are sorted by value in O(N log N).
  *
- * This function iterates through the provided array and returns the index of the first
- * element that is greater than the specified minimum value.
+ * @tparam Holder A type that contains the necessary data:
+ *                - `m_size`: The size of the enumeration array.
+ *                - `m_values`: Values to be used for enumeration.
  *
- * @tparam T Type of the elements in the array.
- * @tparam N Size of the array.
- * @param array The array of elements to search through.
- * @param min The minimum value to compare against.
- * @return std::size_t The index of the next minimum value greater than `min`, or `N` if none is found.
+ * @return std::array<std::size_t, Holder::m_size> The declaration index of every ordinal.
  */
-template<typename T, std::size_t N>
-constexpr auto index_of_next_min(const std::array<T, N>& array, int64_t min)
+template<class Holder>
+constexpr auto create_array_order()
 {
-    std::size_t next_min_index{N};
-    int64_t next_min{std::numeric_limits<T>::max()};
-
-    for (std::size_t index{0}; index < array.size(); ++index)
+    std::array<std::size_t, Holder::m_size> result{};
+    for (size_t index{0}; index < Holder::m_size; ++index)
     {
-        if (min >= static_cast<int64_t>(array[index]))
-        {
-            continue;
-        }
-        if (static_cast<int64_t>(array[index]) < next_min)
-        {
-            next_min = static_cast<int64_t>(array[index]);
-            next_min_index = index;
-        }
+        result[index] = index;
     }
+    trlc::constexpr_utils::sort(result.begin(), result.end(), [](std::size_t lhs, std::size_t rhs) { return Holder::m_values[lhs] < Holder::m_values[rhs]; });
+    return result;
+}
 
-    return next_min_index;
+/**
+ * @brief Creates the ordinal of every declared enum.
+ *
+ * @tparam Holder A type that contains the necessary data:
+ *                - `m_size`: The size of the enumeration array.
+ *                - `m_order`: The declaration index of every ordinal.
+ *
+ * @return std::array<std::size_t, Holder::m_size> The ordinal of every declaration index.
+ */
+template<class Holder>
+constexpr auto create_array_ordinal()
+{
+    std::array<std::size_t, Holder::m_size> result{};
+    for (size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
+    {
+        result[Holder::m_order[ordinal]] = ordinal;
+    }
+    return result;
 }
 
 /**
  * @brief Enumerates an array of values into a specified holder type.
  *
- * This function creates an array of enum types based on the values, names, and descriptions provided
- * in the Holder template. It finds the index of the next valid minimum value for each enumeration.
+ * This function creates an array of enum types sorted by value, following the order
+ * computed in the Holder.
  *
  * @tparam Holder A type that contains the necessary data:
  *                - `enum_type`: The type of the enumeration.
  *                - `m_size`: The size of the enumeration array.
- *                - `m_values`: Values to be used for enumeration.
- *                - `m_names`: Names corresponding to each value.
- *                - `m_descs`: Descriptions corresponding to each value.
+ *                - `m_order`: The declaration index of every ordinal.
  *
  * @return std::array<typename Holder::enum_type, Holder::m_size> An array of enumerated types created from the input holder.
  */
@@ -380,15 +426,9 @@ template<class Holder>
 constexpr auto create_array_enum()
 {
     std::array<typename Holder::enum_type, Holder::m_size> result{};
-    std::int64_t min_value{std::numeric_limits<std::int64_t>::min()};
-
-    for (size_t index{0}; index < Holder::m_size; ++index)
+    for (size_t ordinal{0}; ordinal < Holder::m_size; ++ordinal)
     {
-        auto next_min_index{index_of_next_min(Holder::m_values, min_value)};
-        min_value = static_cast<int64_t>(Holder::m_values[next_min_index]);
-        result[index] = typename Holder::enum_type{Holder::m_values[next_min_index],
-                                                   Holder::m_names[next_min_index],
-                                                   Holder::m_descs[next_min_index]};
+        result[ordinal] = typename Holder::enum_type{Holder::m_order[ordinal]};
     }
     return result;
 }
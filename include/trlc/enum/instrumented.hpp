@@ -0,0 +1,343 @@
+#pragma once
+
+#include "trlc/constexpr_utils.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Enables the recording of InstrumentedPolicy.
+ *
+ * Define it to 0 before including the library to compile InstrumentedPolicy to a plain call
+ * of the policy it wraps, its statistics then stay empty.
+ */
+#ifndef TRLC_ENUM_INSTRUMENTATION
+#define TRLC_ENUM_INSTRUMENTATION 1
+#endif
+
+namespace trlc
+{
+
+/**
+ * @brief Statistics of the lookups of an InstrumentedPolicy.
+ */
+struct LookupStats
+{
+    static constexpr std::size_t CYCLE_BUCKETS{64}; ///< The number of buckets of the cycle histogram.
+
+    std::uint64_t hits{};                              ///< The number of lookups that found an enum.
+    std::uint64_t misses{};                            ///< The number of lookups that found no enum.
+    std::array<std::uint64_t, CYCLE_BUCKETS> cycles{}; ///< cycles[k] counts the lookups of bit_width(cycles) == k, the last bucket the longer ones.
+
+    /**
+     * @brief Returns the number of lookups.
+     *
+     * @return hits + misses.
+     */
+    constexpr std::uint64_t lookups() const
+    {
+        return hits + misses;
+    }
+};
+
+/**
+ * @brief Reads a cheap monotonic cycle counter.
+ *
+ * The time stamp counter on x86, the virtual counter on AArch64, steady_clock nanoseconds elsewhere.
+ *
+ * @return The current count.
+ */
+inline std::uint64_t read_cycle_counter() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    std::uint64_t result;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(result));
+    return result;
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief The thread-local lookup statistics of one Key, with a snapshot over all the threads.
+ *
+ * Every thread records into its own block, written only by that thread with relaxed loads and
+ * stores. The blocks are registered on the first lookup of a thread and folded into the
+ * statistics of the exited threads when it exits.
+ *
+ * @tparam Key The type identifying the statistics.
+ */
+template<class Key>
+struct LookupStatsRegistry
+{
+    using counter_type = std::atomic<std::uint64_t>;
+
+    struct Block
+    {
+        counter_type hits{};
+        counter_type misses{};
+        std::array<counter_type, LookupStats::CYCLE_BUCKETS> cycles{};
+
+        Block()
+        {
+            auto& registry{state()};
+            const std::lock_guard<std::mutex> lock{registry.mutex};
+            registry.blocks.push_back(this);
+        }
+
+        Block(const Block&) = delete;
+        Block& operator=(const Block&) = delete;
+
+        ~Block()
+        {
+            auto& registry{state()};
+            const std::lock_guard<std::mutex> lock{registry.mutex};
+            addTo(registry.retired);
+            for (auto& block : registry.blocks)
+            {
+                if (block == this)
+                {
+                    block = registry.blocks.back();
+                    registry.blocks.pop_back();
+                    break;
+                }
+            }
+        }
+
+        void addTo(LookupStats& stats) const
+        {
+            stats.hits += hits.load(std::memory_order_relaxed);
+            stats.misses += misses.load(std::memory_order_relaxed);
+            for (std::size_t index{0}; index < LookupStats::CYCLE_BUCKETS; ++index)
+            {
+                stats.cycles[index] += cycles[index].load(std::memory_order_relaxed);
+            }
+        }
+
+        void clear()
+        {
+            hits.store(0, std::memory_order_relaxed);
+            misses.store(0, std::memory_order_relaxed);
+            for (auto& count : cycles)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    struct State
+    {
+        std::mutex mutex{};
+        std::vector<Block*> blocks{};
+        LookupStats retired{};
+    };
+
+    /**
+     * @brief Records a lookup of the calling thread.
+     *
+     * @param hit Whether the lookup found an enum.
+     * @param cycles The duration of the lookup, only recorded if MeasureCycles.
+     */
+    template<bool MeasureCycles>
+    static void record(bool hit, std::uint64_t cycles) noexcept
+    {
+        thread_local Block block{};
+        increment(hit ? block.hits : block.misses);
+        if constexpr (MeasureCycles)
+        {
+            const std::size_t bucket{trlc::constexpr_utils::bit_width(cycles)};
+            increment(block.cycles[bucket < LookupStats::CYCLE_BUCKETS ? bucket : LookupStats::CYCLE_BUCKETS - 1]);
+        }
+    }
+
+    /**
+     * @brief Sums the statistics of all the threads.
+     *
+     * The lookups running concurrently may or may not be included.
+     *
+     * @return The statistics.
+     */
+    static LookupStats snapshot()
+    {
+        auto& registry{state()};
+        const std::lock_guard<std::mutex> lock{registry.mutex};
+        LookupStats result{registry.retired};
+        for (const auto* block : registry.blocks)
+        {
+            block->addTo(result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Clears the statistics of all the threads.
+     *
+     * The lookups running concurrently may or may not be cleared.
+     */
+    static void reset()
+    {
+        auto& registry{state()};
+        const std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.retired = LookupStats{};
+        for (auto* block : registry.blocks)
+        {
+            block->clear();
+        }
+    }
+
+private:
+    static State& state()
+    {
+        static State result{};
+        return result;
+    }
+
+    static void increment(counter_type& counter) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+namespace policy
+{
+
+/**
+ * @brief Decorator of a value or name search policy recording the hits, the misses and optionally the cycles of the lookups.
+ *
+ * The statistics are recorded per Holder and per kind of lookup into thread-local counters,
+ * valueStats() and nameStats() sum them over all the threads. Lookups during constant
+ * evaluation are not recorded. With TRLC_ENUM_INSTRUMENTATION defined to 0 the search is
+ * a plain call of Policy.
+ *
+ * @tparam Policy The wrapped search policy, e.g. BinarySearchPolicy.
+ * @tparam MeasureCycles Whether to record a histogram of the cycles of every lookup, see read_cycle_counter().
+ */
+template<class Policy, bool MeasureCycles = false>
+struct InstrumentedPolicy
+{
+    /**
+     * @brief Searches an enum value with Policy and records the lookup.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @param value The enum value to search for.
+     * @return The result of Policy.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(typename Holder::value_type value)
+    {
+        return record<Holder, typename Holder::value_type>([value]()
+                                                           { return Policy::template search<Holder>(value); });
+    }
+
+    /**
+     * @brief Searches an enum name with Policy and records the lookup.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @param name The enum name to search for.
+     * @return The result of Policy.
+     */
+    template<class Holder>
+    static constexpr std::optional<size_t> search(std::string_view name)
+    {
+        return record<Holder, std::string_view>([name]()
+                                                { return Policy::template search<Holder>(name); });
+    }
+
+    /**
+     * @brief Returns the statistics of the value lookups of a Holder over all the threads.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @return The statistics.
+     */
+    template<class Holder>
+    static LookupStats valueStats()
+    {
+        return stats<Holder, typename Holder::value_type>();
+    }
+
+    /**
+     * @brief Returns the statistics of the name lookups of a Holder over all the threads.
+     *
+     * @tparam Holder The holder class of the enum.
+     * @return The statistics.
+     */
+    template<class Holder>
+    static LookupStats nameStats()
+    {
+        return stats<Holder, std::string_view>();
+    }
+
+    /**
+     * @brief Clears the statistics of the value and name lookups of a Holder.
+     *
+     * @tparam Holder The holder class of the enum.
+     */
+    template<class Holder>
+    static void reset()
+    {
+#if TRLC_ENUM_INSTRUMENTATION
+        registry<Holder, typename Holder::value_type>::reset();
+        registry<Holder, std::string_view>::reset();
+#endif
+    }
+
+private:
+    template<class Holder, class Input>
+    struct Key;
+
+    template<class Holder, class Input>
+    using registry = LookupStatsRegistry<Key<Holder, Input>>;
+
+    template<class Holder, class Input>
+    static LookupStats stats()
+    {
+#if TRLC_ENUM_INSTRUMENTATION
+        return registry<Holder, Input>::snapshot();
+#else
+        return LookupStats{};
+#endif
+    }
+
+    template<class Holder, class Input, class Search>
+    static constexpr std::optional<size_t> record(Search search)
+    {
+#if TRLC_ENUM_INSTRUMENTATION
+        if (!trlc::constexpr_utils::is_constant_evaluated())
+        {
+            if constexpr (MeasureCycles)
+            {
+                const std::uint64_t start{read_cycle_counter()};
+                const std::optional<size_t> result{search()};
+                registry<Holder, Input>::template record<true>(result.has_value(), read_cycle_counter() - start);
+                return result;
+            }
+            else
+            {
+                const std::optional<size_t> result{search()};
+                registry<Holder, Input>::template record<false>(result.has_value(), 0);
+                return result;
+            }
+        }
+#endif
+        return search();
+    }
+};
+
+} // namespace policy
+
+} // namespace trlc
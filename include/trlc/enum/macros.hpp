@@ -0,0 +1,141 @@
+#pragma once
+
+/**
+ * The macros declaring TRLC enums, without the library they expand to.
+ *
+ * trlc/enum.hpp includes this header. Code importing the trlc.enums module includes only this
+ * header to declare enums, the entities named by the expansions being exported by the module.
+ */
+
+#include "trlc/macro.hpp" // IWYU pragma: export
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+// clang-format off
+#define TRLC_ENUM_NORMALIZE_HELPER() trlc::enum_feild::NormalizeHelper()
+
+#define TRLC_FIELD(...) TRLC_ENUM_NORMALIZE_HELPER() (TRLC_APPEND(TRLC_STRINGIFY, __delim__, __VA_ARGS__)) * size_t
+
+#define TRLC_ENUM_DECLARE_HELPER(varname, index) static constexpr enum_type varname{index - 1}
+
+#define TRLC_ENUM_DETAIL(enumname, enumdef, ...)                                                                                                              \
+    struct enumname                                                                                                                                           \
+    {                                                                                                                                                         \
+        friend std::integral_constant<std::size_t, TRLC_COUNT_ARGS(__VA_ARGS__)> trlcEnumCount(enumname*);                                                    \
+        using enum_def = enumdef<enumname>;                                                                                                                   \
+        using enum_type = enum_def::enum_type;                                                                                                                \
+        using value_type = enum_def::value_type;                                                                                                              \
+        using name_type = enum_def::enum_type::name_type;                                                                                                     \
+        using iterator_type = enum_def::iterator;                                                                                                             \
+        inline static constexpr std::string_view m_tag{#enumname};                                                                                            \
+        inline static constexpr auto m_fields = trlc::enum_feild::parse_fields({TRLC_EXPAND(TRLC_STRINGIFY, __VA_ARGS__)});                                   \
+        inline static constexpr auto m_values = trlc::enum_feild::array_values<enumname>(m_fields);                                                           \
+        inline static constexpr auto m_names = trlc::enum_feild::create_array_name(m_fields);                                                                 \
+        inline static constexpr auto m_descs = trlc::enum_feild::create_array_description(m_fields);                                                          \
+        inline static constexpr auto m_size = m_values.size();                                                                                                \
+        inline static constexpr auto m_order = trlc::enum_feild::create_array_order<enumname>();                                                              \
+        inline static constexpr auto m_ordinals = trlc::enum_feild::create_array_ordinal<enumname>();                                                         \
+        inline static constexpr auto m_array = trlc::enum_feild::create_array_enum<enumname>();                                                               \
+        TRLC_APPLY_WITH_INDEX(TRLC_ENUM_DECLARE_HELPER, __VA_ARGS__)                                                                                          \
+        static constexpr trlc::EnumHelper<enum_def::holder, enum_def::value_search_policy, enum_def::name_search_policy, enum_def ::unknown_policy> helper{}; \
+        inline static constexpr iterator_type iterator{};                                                                                                     \
+        static constexpr std::optional<enum_type> fromValue(value_type value)                                                                                 \
+        {                                                                                                                                                     \
+            return helper.fromValue(value);                                                                                                                   \
+        }                                                                                                                                                     \
+        static constexpr std::optional<enum_type> fromString(const name_type& name)                                                                           \
+        {                                                                                                                                                     \
+            return helper.fromString(name);                                                                                                                   \
+        }                                                                                                                                                     \
+        static constexpr enum_type fromValueOr(value_type value)                                                                                              \
+        {                                                                                                                                                     \
+            return helper.fromValueOr(value);                                                                                                                 \
+        }                                                                                                                                                     \
+        static constexpr enum_type fromValueOr(value_type value, const enum_type& fallback)                                                                   \
+        {                                                                                                                                                     \
+            return helper.fromValueOr(value, fallback);                                                                                                       \
+        }                                                                                                                                                     \
+        static constexpr enum_type fromStringOr(const name_type& name)                                                                                        \
+        {                                                                                                                                                     \
+            return helper.fromStringOr(name);                                                                                                                 \
+        }                                                                                                                                                     \
+        static constexpr enum_type fromStringOr(const name_type& name, const enum_type& fallback)                                                             \
+        {                                                                                                                                                     \
+            return helper.fromStringOr(name, fallback);                                                                                                       \
+        }                                                                                                                                                     \
+        template<class H = enumname>                                                                                                                          \
+        static constexpr trlc::FromCharsResult<enum_type> fromChars(const char* first, const char* last)                                                      \
+        {                                                                                                                                                     \
+            return H::helper.fromChars(first, last);                                                                                                          \
+        }                                                                                                                                                     \
+        template<class H = enumname>                                                                                                                          \
+        static std::size_t fromValues(const value_type* values, std::size_t count, enum_type* out)                                                            \
+        {                                                                                                                                                     \
+            return trlc::batch::Converter<H>::fromValues(values, count, out);                                                                                 \
+        }                                                                                                                                                     \
+        template<class H = enumname>                                                                                                                          \
+        static std::size_t fromStrings(const name_type* names, std::size_t count, enum_type* out, std::uint64_t* errors, std::size_t thread_count = 1)        \
+        {                                                                                                                                                     \
+            return trlc::batch::Converter<H>::fromStrings(names, count, out, errors, thread_count);                                                           \
+        }                                                                                                                                                     \
+        static constexpr auto size()                                                                                                                          \
+        {                                                                                                                                                     \
+            return m_size;                                                                                                                                    \
+        }                                                                                                                                                     \
+        static constexpr auto tag()                                                                                                                           \
+        {                                                                                                                                                     \
+            return m_tag;                                                                                                                                     \
+        }                                                                                                                                                     \
+        static constexpr std::size_t dumpSize()                                                                                                               \
+        {                                                                                                                                                     \
+            return trlc::holder_dump_size<enumname>;                                                                                                          \
+        }                                                                                                                                                     \
+        template<class OutputIt>                                                                                                                              \
+        static constexpr OutputIt dumpTo(OutputIt out)                                                                                                        \
+        {                                                                                                                                                     \
+            return trlc::dump_holder_to<enumname>(out);                                                                                                       \
+        }                                                                                                                                                     \
+        static constexpr std::to_chars_result dumpTo(char* first, char* last)                                                                                 \
+        {                                                                                                                                                     \
+            return trlc::dump_to_chars(first, last, dumpSize(), [](char* out) { return dumpTo(out); });                                                       \
+        }                                                                                                                                                     \
+        static constexpr std::string_view dump()                                                                                                              \
+        {                                                                                                                                                     \
+            return std::string_view{trlc::holder_dump_chars<enumname>.data(), dumpSize()};                                                                    \
+        }                                                                                                                                                     \
+    };
+
+// clang-format on
+
+/**
+ * @brief Macro to define a Default TRLC Enum with a given name and an arbitrary number of enumeration values.
+ *
+ * This macro expands into a call to a detailed macro that performs the actual enum definition logic.
+ *
+ * @param enumname The name of the enum being defined.
+ * @param ... A variable number of enumeration values, which can include:
+ *   - Normal enum values
+ *   - TRLC_FIELD directives for value and descriptions,
+ *     allowing for rich metadata associated with each enum value.
+ *
+ * @example
+ * Example usage of the TRLC_ENUM macro to define an enumeration.
+ *
+ * TRLC_ENUM(Colors,
+ *         RED,
+ *         GREEN = TRLC_FIELD(value = 1),
+ *         BLUE = TRLC_FIELD(desc = "Sky color"),
+ *         YELLOW = TRLC_FIELD(value = 2, desc = "Color of ripe bananas."))
+ * In this example, we define an enumeration called Colors with several values:
+ * - RED: A regular enumerator with no associated metadata.
+ * - GREEN: Assigned a value of 1.
+ * - BLUE: Has a description indicating it is the color of the sky.
+ * - YELLOW: Assigned a value of 2 and a description relating to ripe bananas.
+ */
+#define TRLC_ENUM(enumname, ...) \
+    TRLC_ENUM_DETAIL(enumname, trlc::DefaultEnumDef, __VA_ARGS__)
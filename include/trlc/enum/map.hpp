@@ -0,0 +1,228 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace trlc
+{
+
+/**
+ * @brief A fixed size map from the enums of a Holder to values.
+ *
+ * The values are stored contiguously in a std::array indexed by the ordinal of the enums,
+ * so every access is a single indexed load, without hashing or allocation.
+ * Iteration follows the EnumIterator order.
+ *
+ * @tparam Holder The holder class of the enum, e.g. the name given to TRLC_ENUM.
+ * @tparam V The type of the mapped values.
+ */
+template<class Holder, typename V>
+struct EnumMap
+{
+    using key_type = typename Holder::enum_type; ///< The type of the keys.
+    using mapped_type = V;                       ///< The type of the mapped values.
+
+    std::array<V, Holder::size()> m_values{}; ///< The mapped values indexed by ordinal.
+
+    template<bool Const>
+    struct Iterator
+    {
+        using reference = std::conditional_t<Const, const V&, V&>;
+        using map_type = std::conditional_t<Const, const EnumMap, EnumMap>;
+
+        map_type* map{};
+        std::size_t index{};
+
+        // Dereference operator
+        constexpr std::pair<key_type, reference> operator*() const
+        {
+            return {Holder::m_array[index], map->m_values[index]};
+        }
+
+        // Pre-increment operator
+        constexpr Iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        // Comparison operators
+        constexpr bool operator!=(const Iterator& other) const
+        {
+            return index != other.index;
+        }
+        constexpr bool operator==(const Iterator& other) const
+        {
+            return index == other.index;
+        }
+    };
+
+    using iterator = Iterator<false>;      ///< The iterator type.
+    using const_iterator = Iterator<true>; ///< The const iterator type.
+
+    constexpr EnumMap() = default;
+
+    /**
+     * @brief Constructs an EnumMap with every key mapped to the same value.
+     *
+     * @param value The value of every key.
+     */
+    constexpr explicit EnumMap(const V& value)
+    {
+        fill(value);
+    }
+
+    /**
+     * @brief Constructs an EnumMap from key-value pairs.
+     *
+     * The keys not in the list are mapped to a value initialized V.
+     *
+     * @param init The key-value pairs.
+     */
+    constexpr EnumMap(std::initializer_list<std::pair<key_type, V>> init)
+    {
+        for (const auto& item : init)
+        {
+            m_values[item.first.ordinal()] = item.second;
+        }
+    }
+
+    /**
+     * @brief Accesses the value mapped to a key.
+     *
+     * @param key The enum key.
+     * @return A reference to the mapped value.
+     */
+    constexpr V& operator[](const key_type& key)
+    {
+        return m_values[key.ordinal()];
+    }
+
+    /**
+     * @brief Accesses the value mapped to a key.
+     *
+     * @param key The enum key.
+     * @return A const reference to the mapped value.
+     */
+    constexpr const V& operator[](const key_type& key) const
+    {
+        return m_values[key.ordinal()];
+    }
+
+    /**
+     * @brief Maps every key to the same value.
+     *
+     * @param value The value of every key.
+     */
+    constexpr void fill(const V& value)
+    {
+        for (auto& item : m_values)
+        {
+            item = value;
+        }
+    }
+
+    /**
+     * @brief Returns the number of keys, equal to Holder::size().
+     *
+     * @return The number of keys.
+     */
+    static constexpr std::size_t size()
+    {
+        return Holder::size();
+    }
+
+    /**
+     * @brief Returns a pointer to the contiguous mapped values, in ordinal order.
+     *
+     * @return A pointer to the first mapped value.
+     */
+    constexpr V* data()
+    {
+        return m_values.data();
+    }
+
+    /**
+     * @brief Returns a pointer to the contiguous mapped values, in ordinal order.
+     *
+     * @return A const pointer to the first mapped value.
+     */
+    constexpr const V* data() const
+    {
+        return m_values.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first key-value pair.
+     *
+     * @return Iterator pointing to the start of the map.
+     */
+    constexpr iterator begin()
+    {
+        return iterator{this, 0};
+    }
+
+    /**
+     * @brief Returns an iterator past the last key-value pair.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    constexpr iterator end()
+    {
+        return iterator{this, Holder::size()};
+    }
+
+    /**
+     * @brief Returns a const iterator to the first key-value pair.
+     *
+     * @return Const iterator pointing to the start of the map.
+     */
+    constexpr const_iterator begin() const
+    {
+        return const_iterator{this, 0};
+    }
+
+    /**
+     * @brief Returns a const iterator past the last key-value pair.
+     *
+     * @return Const iterator pointing past the last element.
+     */
+    constexpr const_iterator end() const
+    {
+        return const_iterator{this, Holder::size()};
+    }
+
+    /**
+     * @brief Compares two EnumMap objects for equality.
+     *
+     * @param other The other EnumMap object to compare with.
+     * @return True if every key is mapped to equal values; otherwise, false.
+     */
+    constexpr bool operator==(const EnumMap& other) const
+    {
+        for (std::size_t index{0}; index < Holder::size(); ++index)
+        {
+            if (!(m_values[index] == other.m_values[index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compares two EnumMap objects for inequality.
+     *
+     * @param other The other EnumMap object to compare with.
+     * @return True if any key is mapped to different values; otherwise, false.
+     */
+    constexpr bool operator!=(const EnumMap& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+} // namespace trlc
@@ -0,0 +1,314 @@
+#pragma once
+
+#include "trlc/constexpr_utils.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace trlc
+{
+
+/**
+ * @brief A fixed size set of the enums of a Holder.
+ *
+ * Every enum is a bit at the position of its ordinal, packed in 64-bit words, so membership
+ * tests compute the ordinal once and are then a single shift and mask, set operations work a word at a time and iteration
+ * visits the bits set in EnumIterator order.
+ *
+ * @tparam Holder The holder class of the enum, e.g. the name given to TRLC_ENUM.
+ */
+template<class Holder>
+struct EnumSet
+{
+    using key_type = typename Holder::enum_type; ///< The type of the elements.
+    using word_type = std::uint64_t;             ///< The type of the words storing the bits.
+
+    static constexpr std::size_t WORD_BITS{64};
+    static constexpr std::size_t WORD_COUNT{(Holder::size() + WORD_BITS - 1) / WORD_BITS};
+
+    std::array<word_type, WORD_COUNT> m_words{}; ///< The bits of the set indexed by ordinal.
+
+    struct Iterator
+    {
+        const EnumSet* set{};
+        std::size_t word{};
+        word_type bits{};
+
+        constexpr Iterator(const EnumSet* owner, std::size_t index)
+            : set{owner}
+            , word{index}
+        {
+            if (word < WORD_COUNT)
+            {
+                bits = set->m_words[word];
+                skipEmptyWords();
+            }
+        }
+
+        // Dereference operator
+        constexpr const key_type operator*() const
+        {
+            return Holder::m_array[word * WORD_BITS + trlc::constexpr_utils::countr_zero(bits)];
+        }
+
+        // Pre-increment operator
+        constexpr Iterator& operator++()
+        {
+            bits &= bits - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        // Comparison operators
+        constexpr bool operator!=(const Iterator& other) const
+        {
+            return word != other.word || bits != other.bits;
+        }
+        constexpr bool operator==(const Iterator& other) const
+        {
+            return word == other.word && bits == other.bits;
+        }
+
+    private:
+        constexpr void skipEmptyWords()
+        {
+            while (bits == 0 && ++word < WORD_COUNT)
+            {
+                bits = set->m_words[word];
+            }
+        }
+    };
+
+    constexpr EnumSet() = default;
+
+    /**
+     * @brief Constructs an EnumSet from a list of enums.
+     *
+     * @param init The enums in the set.
+     */
+    constexpr EnumSet(std::initializer_list<key_type> init)
+    {
+        for (const auto& key : init)
+        {
+            insert(key);
+        }
+    }
+
+    /**
+     * @brief Returns the set of all the enums of the Holder.
+     *
+     * @return The full set.
+     */
+    static constexpr EnumSet all()
+    {
+        EnumSet result{};
+        for (std::size_t index{0}; index < WORD_COUNT; ++index)
+        {
+            result.m_words[index] = ~word_type{0};
+        }
+        if (Holder::size() % WORD_BITS != 0)
+        {
+            result.m_words[WORD_COUNT - 1] = (word_type{1} << (Holder::size() % WORD_BITS)) - 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Adds an enum to the set.
+     *
+     * @param key The enum to add.
+     */
+    constexpr void insert(const key_type& key)
+    {
+        const std::size_t ordinal{key.ordinal()};
+        m_words[ordinal / WORD_BITS] |= mask(ordinal);
+    }
+
+    /**
+     * @brief Removes an enum from the set.
+     *
+     * @param key The enum to remove.
+     */
+    constexpr void erase(const key_type& key)
+    {
+        const std::size_t ordinal{key.ordinal()};
+        m_words[ordinal / WORD_BITS] &= ~mask(ordinal);
+    }
+
+    /**
+     * @brief Checks whether an enum is in the set.
+     *
+     * @param key The enum to check.
+     * @return True if the enum is in the set; otherwise, false.
+     */
+    constexpr bool contains(const key_type& key) const
+    {
+        const std::size_t ordinal{key.ordinal()};
+        return (m_words[ordinal / WORD_BITS] & mask(ordinal)) != 0;
+    }
+
+    /**
+     * @brief Removes all the enums from the set.
+     */
+    constexpr void clear()
+    {
+        for (auto& word : m_words)
+        {
+            word = 0;
+        }
+    }
+
+    /**
+     * @brief Returns the number of enums in the set.
+     *
+     * @return The number of bits set.
+     */
+    constexpr std::size_t size() const
+    {
+        std::size_t result{0};
+        for (const auto& word : m_words)
+        {
+            result += trlc::constexpr_utils::popcount(word);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Checks whether the set is empty.
+     *
+     * @return True if no enum is in the set; otherwise, false.
+     */
+    constexpr bool empty() const
+    {
+        for (const auto& word : m_words)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns an iterator to the first enum of the set.
+     *
+     * @return Iterator pointing to the start of the set.
+     */
+    constexpr Iterator begin() const
+    {
+        return Iterator{this, 0};
+    }
+
+    /**
+     * @brief Returns an iterator past the last enum of the set.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    constexpr Iterator end() const
+    {
+        return Iterator{this, WORD_COUNT};
+    }
+
+    /**
+     * @brief Adds the enums of another set (union).
+     *
+     * @param other The other set.
+     * @return A reference to this set.
+     */
+    constexpr EnumSet& operator|=(const EnumSet& other)
+    {
+        for (std::size_t index{0}; index < WORD_COUNT; ++index)
+        {
+            m_words[index] |= other.m_words[index];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Keeps only the enums also in another set (intersection).
+     *
+     * @param other The other set.
+     * @return A reference to this set.
+     */
+    constexpr EnumSet& operator&=(const EnumSet& other)
+    {
+        for (std::size_t index{0}; index < WORD_COUNT; ++index)
+        {
+            m_words[index] &= other.m_words[index];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Removes the enums of another set (difference).
+     *
+     * @param other The other set.
+     * @return A reference to this set.
+     */
+    constexpr EnumSet& operator-=(const EnumSet& other)
+    {
+        for (std::size_t index{0}; index < WORD_COUNT; ++index)
+        {
+            m_words[index] &= ~other.m_words[index];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet operator|(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result |= other;
+    }
+
+    constexpr EnumSet operator&(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result &= other;
+    }
+
+    constexpr EnumSet operator-(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result -= other;
+    }
+
+    /**
+     * @brief Compares two EnumSet objects for equality.
+     *
+     * @param other The other EnumSet object to compare with.
+     * @return True if both sets have the same enums; otherwise, false.
+     */
+    constexpr bool operator==(const EnumSet& other) const
+    {
+        for (std::size_t index{0}; index < WORD_COUNT; ++index)
+        {
+            if (m_words[index] != other.m_words[index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compares two EnumSet objects for inequality.
+     *
+     * @param other The other EnumSet object to compare with.
+     * @return True if the sets have different enums; otherwise, false.
+     */
+    constexpr bool operator!=(const EnumSet& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    static constexpr word_type mask(std::size_t ordinal)
+    {
+        return word_type{1} << (ordinal % WORD_BITS);
+    }
+};
+
+} // namespace trlc
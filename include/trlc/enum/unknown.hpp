@@ -0,0 +1,386 @@
+#pragma once
+
+#include "trlc/constexpr_utils.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace trlc
+{
+
+/**
+ * @brief An input that matched no enum, a value or a name.
+ *
+ * Names are copied, truncated to MaxNameSize characters.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam MaxNameSize The maximum number of stored characters of a name.
+ */
+template<typename T, std::size_t MaxNameSize = 32>
+struct UnknownInput
+{
+    bool m_is_name{};                        ///< Whether the input is a name.
+    T m_value{};                             ///< The value, if the input is not a name.
+    std::size_t m_size{};                    ///< The size of the name, before truncation.
+    std::array<char, MaxNameSize> m_chars{}; ///< The first characters of the name.
+
+    /**
+     * @brief Checks whether the input is a name.
+     *
+     * @return True for a name, false for a value.
+     */
+    constexpr bool isName() const
+    {
+        return m_is_name;
+    }
+
+    /**
+     * @brief Returns the value of a value input.
+     *
+     * @return The value.
+     */
+    constexpr T value() const
+    {
+        return m_value;
+    }
+
+    /**
+     * @brief Returns the name of a name input, truncated to MaxNameSize characters.
+     *
+     * @return The name.
+     */
+    constexpr std::string_view name() const
+    {
+        return std::string_view{m_chars.data(), m_size < MaxNameSize ? m_size : MaxNameSize};
+    }
+
+    /**
+     * @brief Checks whether the name was truncated.
+     *
+     * @return True if the name is longer than MaxNameSize characters.
+     */
+    constexpr bool truncated() const
+    {
+        return m_size > MaxNameSize;
+    }
+};
+
+/**
+ * @brief A bounded lock-free capture of the inputs that matched no enum.
+ *
+ * Every distinct input is captured once: a hash of the input, odd for names and even for
+ * values, is first inserted into a set of SeenCapacity hashes, and only the inputs not seen
+ * before are pushed into a ring buffer of Capacity inputs. Inputs are dropped and counted
+ * when the set or the ring is full, so the capture never blocks, allocates or takes a lock.
+ * An input dropped by a full ring is removed from the set again, it is captured by a later
+ * call once the ring is drained.
+ * Any number of threads capture and drain concurrently. Every slot of the ring has a sequence
+ * number, even while free for a lap and odd while full, so all the state is constant
+ * initialized and the capture can be a static.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam Capacity The number of inputs of the ring buffer, a power of two.
+ * @tparam SeenCapacity The number of hashes of the set of the seen inputs, a power of two.
+ */
+template<typename T, std::size_t Capacity = 64, std::size_t SeenCapacity = 256>
+struct UnknownInputCapture
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+    static_assert(SeenCapacity > 0 && (SeenCapacity & (SeenCapacity - 1)) == 0, "SeenCapacity must be a power of two.");
+
+    using input_type = UnknownInput<T>; ///< The type of the captured inputs.
+
+    static constexpr std::size_t MAX_PROBES{8}; ///< Maximum number of slots of the seen set visited per input.
+
+    struct Slot
+    {
+        std::atomic<std::size_t> m_sequence{}; ///< Twice the lap of the slot, plus one while it holds an input.
+        input_type m_input{};                  ///< The input, written before the sequence is published.
+    };
+
+    std::array<Slot, Capacity> m_slots{};                          ///< The ring buffer.
+    std::atomic<std::size_t> m_tail{};                             ///< The position of the next push.
+    std::atomic<std::size_t> m_head{};                             ///< The position of the next pop.
+    std::array<std::atomic<std::uint64_t>, SeenCapacity> m_seen{}; ///< The hashes of the seen inputs, 0 for free slots.
+    std::atomic<std::uint64_t> m_dropped{};                        ///< The number of new inputs dropped.
+
+    /**
+     * @brief Captures a value, unless it was seen before.
+     *
+     * @param value The value.
+     * @return True if the value was captured.
+     */
+    bool capture(T value) noexcept
+    {
+        const std::uint64_t hash{trlc::constexpr_utils::mix(static_cast<std::uint64_t>(value)) << 2 | 2};
+        auto* seen{insertSeen(hash)};
+        if (seen == nullptr)
+        {
+            return false;
+        }
+        input_type input{};
+        input.m_value = value;
+        return pushOrForget(input, *seen, hash);
+    }
+
+    /**
+     * @brief Captures a name, unless it was seen before.
+     *
+     * @param name The name.
+     * @return True if the name was captured.
+     */
+    bool capture(std::string_view name) noexcept
+    {
+        const std::uint64_t hash{trlc::constexpr_utils::hash(name) | 1};
+        auto* seen{insertSeen(hash)};
+        if (seen == nullptr)
+        {
+            return false;
+        }
+        input_type input{};
+        input.m_is_name = true;
+        input.m_size = name.size();
+        for (std::size_t index{0}; index < input.name().size(); ++index)
+        {
+            input.m_chars[index] = name[index];
+        }
+        return pushOrForget(input, *seen, hash);
+    }
+
+    /**
+     * @brief Removes the captured inputs, oldest first.
+     *
+     * @param function Called with every removed input.
+     * @return The number of removed inputs.
+     */
+    template<class Function>
+    std::size_t drain(Function function)
+    {
+        std::size_t result{0};
+        input_type input{};
+        while (pop(input))
+        {
+            function(static_cast<const input_type&>(input));
+            ++result;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the number of new inputs dropped because the seen set or the ring was full.
+     *
+     * @return The number of dropped inputs.
+     */
+    std::uint64_t dropped() const noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Forgets the seen inputs, so that they are captured again.
+     */
+    void forget() noexcept
+    {
+        for (auto& hash : m_seen)
+        {
+            hash.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<std::uint64_t>* insertSeen(std::uint64_t hash) noexcept
+    {
+        // The low bits of the hashes tell names from values, the probes start from the high ones.
+        // Slots are freed again by pushOrForget, so the whole window is searched for the hash
+        // before an empty slot is claimed.
+        const std::size_t start{static_cast<std::size_t>(hash >> 32)};
+        while (true)
+        {
+            std::atomic<std::uint64_t>* empty{nullptr};
+            for (std::size_t probe{0}; probe < MAX_PROBES; ++probe)
+            {
+                auto& slot{m_seen[(start + probe) & (SeenCapacity - 1)]};
+                const std::uint64_t current{slot.load(std::memory_order_relaxed)};
+                if (current == hash)
+                {
+                    return nullptr;
+                }
+                if (current == 0 && empty == nullptr)
+                {
+                    empty = &slot;
+                }
+            }
+            if (empty == nullptr)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            std::uint64_t expected{0};
+            if (empty->compare_exchange_strong(expected, hash, std::memory_order_relaxed))
+            {
+                return empty;
+            }
+            if (expected == hash)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    bool pushOrForget(const input_type& input, std::atomic<std::uint64_t>& seen, std::uint64_t hash) noexcept
+    {
+        if (push(input))
+        {
+            return true;
+        }
+        seen.compare_exchange_strong(hash, 0, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool push(const input_type& input) noexcept
+    {
+        std::size_t position{m_tail.load(std::memory_order_relaxed)};
+        while (true)
+        {
+            Slot& slot{m_slots[position & (Capacity - 1)]};
+            const std::size_t free{2 * (position / Capacity)};
+            const std::size_t sequence{slot.m_sequence.load(std::memory_order_acquire)};
+            if (sequence == free)
+            {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.m_input = input;
+                    slot.m_sequence.store(free + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < free)
+            {
+                // The slot still holds the input of the previous lap, the ring is full.
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(input_type& input) noexcept
+    {
+        std::size_t position{m_head.load(std::memory_order_relaxed)};
+        while (true)
+        {
+            Slot& slot{m_slots[position & (Capacity - 1)]};
+            const std::size_t full{2 * (position / Capacity) + 1};
+            const std::size_t sequence{slot.m_sequence.load(std::memory_order_acquire)};
+            if (sequence == full)
+            {
+                if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    input = slot.m_input;
+                    slot.m_sequence.store(full + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < full)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+namespace policy
+{
+
+/**
+ * @brief Policy for handling unknown enum values and names by capturing them.
+ *
+ * It returns nullopt as UnknownPolicy, and captures the unmatched inputs of fromValue and
+ * fromString at runtime into the UnknownInputCapture of the Holder, drained with captured().
+ * The unmatched buffers of fromChars are not captured, their extent is unknown.
+ *
+ * @tparam Capacity The number of inputs of the ring buffer, a power of two.
+ * @tparam SeenCapacity The number of hashes of the set of the seen inputs, a power of two.
+ */
+template<std::size_t Capacity = 64, std::size_t SeenCapacity = 256>
+struct CaptureUnknownPolicy
+{
+    template<class Holder>
+    using capture_type = UnknownInputCapture<typename Holder::value_type, Capacity, SeenCapacity>;
+
+    template<class Holder>
+    inline static capture_type<Holder> m_capture{};
+
+    /**
+     * @brief Returns the capture of the unknown inputs of a Holder.
+     *
+     * @tparam Holder The holder class storing the enum data.
+     * @return The capture.
+     */
+    template<class Holder>
+    static capture_type<Holder>& captured()
+    {
+        return m_capture<Holder>;
+    }
+
+    /**
+     * @brief Handles unknown enums by returning nullopt.
+     *
+     * @tparam Holder The holder class storing the enum data.
+     * @return An std::optional containing a nullopt to signify no match.
+     */
+    template<class Holder>
+    static constexpr std::optional<typename Holder::enum_type> handle()
+    {
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Handles an unknown value by capturing it and returning nullopt.
+     *
+     * @tparam Holder The holder class storing the enum data.
+     * @param value The value that matched no enum.
+     * @return An std::optional containing a nullopt to signify no match.
+     */
+    template<class Holder>
+    static constexpr std::optional<typename Holder::enum_type> handle(typename Holder::value_type value)
+    {
+        if (!trlc::constexpr_utils::is_constant_evaluated())
+        {
+            m_capture<Holder>.capture(value);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Handles an unknown name by capturing it and returning nullopt.
+     *
+     * @tparam Holder The holder class storing the enum data.
+     * @param name The name that matched no enum.
+     * @return An std::optional containing a nullopt to signify no match.
+     */
+    template<class Holder>
+    static constexpr std::optional<typename Holder::enum_type> handle(std::string_view name)
+    {
+        if (!trlc::constexpr_utils::is_constant_evaluated())
+        {
+            m_capture<Holder>.capture(name);
+        }
+        return std::nullopt;
+    }
+};
+
+} // namespace policy
+
+} // namespace trlc
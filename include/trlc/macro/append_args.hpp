@@ -0,0 +1,1058 @@
+
+
+/**
+ * This file is automatically generated from a Python script.
+ * 
+ * If you wish to change the number of recursive argument expansions or the output directory,
+ * please rerun the script and replace this file with the newly generated version.
+ * 
+ * Note: Modifications made directly to this file will be overwritten
+ * the next time the script is executed.
+ * 
+ * To run the script, use the following command:
+ * 
+ *     python3 macro_expansion_generator.py <N> [directory]
+ * 
+ * Where <N> is the number of recursive expansions you want (e.g., 125).
+ * [directory] is optional and specifies the output directory for the generated files.
+ */
+#pragma once
+
+// clang-format off
+
+#include "count_args.hpp"
+
+// Macro to append a expr to each argument
+#define TRLC_APPEND(MACRO, delim,...) TRLC_APPEND_IMPL(MACRO, delim, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
+#define TRLC_APPEND_IMPL(MACRO, delim, COUNT, ...) TRLC_APPEND_IMPL2(MACRO, delim, COUNT, __VA_ARGS__)
+#define TRLC_APPEND_IMPL2(MACRO, delim, COUNT,...) TRLC_APPEND_##COUNT(MACRO, delim, __VA_ARGS__)
+
+// Recursive appending of arguments based on count
+#define TRLC_APPEND_1(MACRO, delim, arg1) MACRO(arg1)
+#define TRLC_APPEND_2(MACRO, delim, arg1, arg2) MACRO(arg1##delim##arg2)
+#define TRLC_APPEND_3(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_2(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_4(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_3(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_5(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_4(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_6(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_5(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_7(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_6(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_8(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_7(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_9(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_8(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_10(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_9(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_11(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_10(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_12(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_11(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_13(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_12(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_14(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_13(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_15(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_14(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_16(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_15(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_17(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_16(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_18(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_17(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_19(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_18(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_20(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_19(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_21(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_20(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_22(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_21(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_23(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_22(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_24(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_23(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_25(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_24(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_26(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_25(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_27(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_26(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_28(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_27(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_29(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_28(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_30(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_29(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_31(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_30(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_32(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_31(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_33(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_32(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_34(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_33(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_35(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_34(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_36(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_35(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_37(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_36(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_38(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_37(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_39(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_38(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_40(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_39(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_41(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_40(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_42(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_41(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_43(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_42(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_44(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_43(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_45(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_44(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_46(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_45(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_47(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_46(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_48(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_47(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_49(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_48(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_50(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_49(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_51(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_50(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_52(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_51(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_53(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_52(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_54(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_53(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_55(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_54(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_56(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_55(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_57(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_56(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_58(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_57(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_59(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_58(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_60(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_59(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_61(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_60(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_62(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_61(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_63(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_62(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_64(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_63(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_65(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_64(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_66(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_65(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_67(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_66(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_68(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_67(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_69(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_68(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_70(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_69(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_71(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_70(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_72(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_71(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_73(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_72(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_74(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_73(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_75(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_74(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_76(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_75(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_77(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_76(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_78(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_77(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_79(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_78(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_80(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_79(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_81(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_80(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_82(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_81(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_83(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_82(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_84(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_83(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_85(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_84(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_86(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_85(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_87(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_86(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_88(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_87(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_89(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_88(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_90(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_89(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_91(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_90(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_92(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_91(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_93(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_92(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_94(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_93(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_95(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_94(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_96(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_95(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_97(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_96(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_98(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_97(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_99(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_98(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_100(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_99(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_101(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_100(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_102(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_101(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_103(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_102(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_104(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_103(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_105(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_104(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_106(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_105(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_107(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_106(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_108(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_107(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_109(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_108(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_110(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_109(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_111(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_110(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_112(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_111(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_113(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_112(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_114(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_113(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_115(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_114(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_116(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_115(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_117(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_116(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_118(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_117(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_119(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_118(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_120(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_119(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_121(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_120(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_122(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_121(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_123(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_122(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_124(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_123(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_125(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_124(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_126(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_125(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_127(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_126(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_128(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_127(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_129(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_128(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_130(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_129(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_131(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_130(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_132(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_131(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_133(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_132(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_134(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_133(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_135(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_134(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_136(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_135(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_137(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_136(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_138(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_137(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_139(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_138(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_140(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_139(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_141(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_140(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_142(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_141(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_143(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_142(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_144(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_143(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_145(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_144(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_146(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_145(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_147(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_146(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_148(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_147(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_149(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_148(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_150(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_149(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_151(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_150(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_152(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_151(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_153(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_152(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_154(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_153(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_155(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_154(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_156(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_155(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_157(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_156(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_158(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_157(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_159(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_158(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_160(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_159(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_161(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_160(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_162(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_161(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_163(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_162(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_164(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_163(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_165(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_164(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_166(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_165(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_167(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_166(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_168(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_167(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_169(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_168(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_170(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_169(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_171(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_170(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_172(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_171(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_173(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_172(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_174(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_173(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_175(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_174(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_176(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_175(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_177(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_176(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_178(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_177(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_179(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_178(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_180(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_179(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_181(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_180(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_182(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_181(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_183(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_182(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_184(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_183(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_185(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_184(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_186(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_185(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_187(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_186(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_188(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_187(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_189(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_188(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_190(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_189(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_191(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_190(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_192(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_191(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_193(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_192(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_194(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_193(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_195(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_194(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_196(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_195(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_197(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_196(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_198(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_197(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_199(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_198(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_200(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_199(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_201(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_200(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_202(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_201(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_203(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_202(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_204(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_203(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_205(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_204(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_206(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_205(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_207(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_206(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_208(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_207(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_209(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_208(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_210(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_209(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_211(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_210(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_212(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_211(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_213(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_212(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_214(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_213(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_215(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_214(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_216(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_215(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_217(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_216(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_218(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_217(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_219(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_218(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_220(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_219(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_221(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_220(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_222(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_221(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_223(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_222(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_224(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_223(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_225(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_224(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_226(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_225(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_227(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_226(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_228(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_227(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_229(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_228(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_230(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_229(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_231(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_230(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_232(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_231(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_233(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_232(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_234(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_233(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_235(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_234(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_236(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_235(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_237(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_236(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_238(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_237(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_239(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_238(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_240(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_239(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_241(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_240(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_242(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_241(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_243(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_242(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_244(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_243(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_245(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_244(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_246(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_245(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_247(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_246(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_248(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_247(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_249(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_248(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_250(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_249(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_251(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_250(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_252(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_251(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_253(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_252(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_254(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_253(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_255(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_254(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_256(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_255(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_257(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_256(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_258(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_257(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_259(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_258(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_260(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_259(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_261(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_260(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_262(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_261(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_263(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_262(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_264(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_263(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_265(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_264(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_266(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_265(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_267(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_266(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_268(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_267(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_269(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_268(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_270(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_269(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_271(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_270(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_272(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_271(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_273(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_272(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_274(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_273(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_275(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_274(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_276(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_275(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_277(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_276(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_278(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_277(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_279(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_278(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_280(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_279(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_281(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_280(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_282(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_281(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_283(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_282(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_284(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_283(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_285(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_284(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_286(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_285(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_287(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_286(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_288(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_287(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_289(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_288(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_290(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_289(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_291(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_290(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_292(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_291(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_293(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_292(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_294(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_293(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_295(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_294(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_296(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_295(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_297(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_296(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_298(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_297(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_299(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_298(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_300(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_299(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_301(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_300(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_302(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_301(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_303(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_302(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_304(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_303(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_305(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_304(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_306(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_305(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_307(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_306(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_308(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_307(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_309(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_308(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_310(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_309(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_311(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_310(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_312(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_311(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_313(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_312(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_314(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_313(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_315(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_314(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_316(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_315(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_317(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_316(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_318(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_317(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_319(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_318(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_320(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_319(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_321(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_320(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_322(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_321(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_323(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_322(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_324(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_323(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_325(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_324(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_326(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_325(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_327(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_326(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_328(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_327(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_329(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_328(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_330(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_329(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_331(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_330(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_332(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_331(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_333(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_332(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_334(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_333(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_335(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_334(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_336(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_335(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_337(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_336(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_338(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_337(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_339(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_338(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_340(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_339(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_341(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_340(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_342(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_341(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_343(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_342(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_344(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_343(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_345(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_344(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_346(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_345(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_347(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_346(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_348(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_347(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_349(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_348(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_350(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_349(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_351(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_350(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_352(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_351(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_353(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_352(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_354(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_353(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_355(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_354(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_356(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_355(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_357(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_356(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_358(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_357(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_359(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_358(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_360(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_359(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_361(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_360(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_362(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_361(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_363(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_362(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_364(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_363(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_365(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_364(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_366(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_365(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_367(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_366(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_368(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_367(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_369(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_368(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_370(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_369(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_371(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_370(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_372(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_371(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_373(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_372(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_374(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_373(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_375(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_374(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_376(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_375(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_377(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_376(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_378(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_377(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_379(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_378(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_380(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_379(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_381(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_380(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_382(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_381(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_383(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_382(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_384(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_383(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_385(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_384(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_386(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_385(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_387(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_386(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_388(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_387(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_389(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_388(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_390(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_389(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_391(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_390(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_392(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_391(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_393(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_392(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_394(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_393(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_395(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_394(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_396(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_395(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_397(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_396(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_398(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_397(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_399(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_398(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_400(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_399(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_401(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_400(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_402(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_401(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_403(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_402(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_404(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_403(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_405(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_404(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_406(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_405(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_407(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_406(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_408(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_407(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_409(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_408(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_410(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_409(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_411(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_410(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_412(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_411(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_413(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_412(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_414(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_413(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_415(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_414(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_416(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_415(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_417(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_416(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_418(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_417(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_419(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_418(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_420(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_419(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_421(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_420(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_422(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_421(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_423(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_422(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_424(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_423(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_425(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_424(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_426(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_425(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_427(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_426(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_428(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_427(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_429(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_428(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_430(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_429(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_431(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_430(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_432(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_431(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_433(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_432(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_434(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_433(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_435(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_434(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_436(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_435(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_437(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_436(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_438(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_437(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_439(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_438(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_440(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_439(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_441(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_440(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_442(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_441(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_443(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_442(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_444(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_443(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_445(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_444(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_446(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_445(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_447(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_446(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_448(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_447(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_449(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_448(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_450(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_449(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_451(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_450(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_452(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_451(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_453(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_452(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_454(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_453(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_455(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_454(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_456(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_455(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_457(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_456(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_458(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_457(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_459(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_458(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_460(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_459(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_461(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_460(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_462(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_461(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_463(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_462(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_464(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_463(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_465(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_464(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_466(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_465(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_467(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_466(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_468(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_467(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_469(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_468(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_470(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_469(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_471(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_470(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_472(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_471(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_473(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_472(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_474(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_473(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_475(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_474(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_476(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_475(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_477(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_476(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_478(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_477(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_479(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_478(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_480(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_479(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_481(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_480(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_482(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_481(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_483(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_482(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_484(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_483(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_485(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_484(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_486(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_485(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_487(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_486(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_488(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_487(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_489(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_488(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_490(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_489(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_491(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_490(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_492(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_491(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_493(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_492(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_494(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_493(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_495(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_494(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_496(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_495(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_497(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_496(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_498(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_497(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_499(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_498(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_500(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_499(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_501(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_500(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_502(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_501(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_503(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_502(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_504(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_503(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_505(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_504(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_506(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_505(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_507(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_506(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_508(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_507(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_509(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_508(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_510(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_509(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_511(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_510(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_512(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_511(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_513(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_512(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_514(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_513(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_515(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_514(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_516(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_515(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_517(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_516(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_518(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_517(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_519(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_518(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_520(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_519(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_521(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_520(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_522(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_521(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_523(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_522(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_524(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_523(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_525(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_524(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_526(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_525(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_527(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_526(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_528(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_527(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_529(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_528(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_530(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_529(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_531(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_530(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_532(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_531(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_533(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_532(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_534(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_533(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_535(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_534(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_536(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_535(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_537(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_536(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_538(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_537(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_539(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_538(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_540(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_539(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_541(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_540(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_542(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_541(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_543(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_542(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_544(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_543(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_545(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_544(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_546(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_545(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_547(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_546(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_548(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_547(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_549(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_548(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_550(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_549(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_551(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_550(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_552(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_551(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_553(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_552(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_554(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_553(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_555(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_554(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_556(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_555(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_557(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_556(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_558(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_557(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_559(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_558(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_560(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_559(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_561(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_560(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_562(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_561(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_563(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_562(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_564(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_563(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_565(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_564(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_566(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_565(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_567(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_566(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_568(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_567(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_569(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_568(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_570(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_569(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_571(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_570(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_572(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_571(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_573(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_572(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_574(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_573(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_575(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_574(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_576(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_575(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_577(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_576(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_578(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_577(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_579(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_578(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_580(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_579(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_581(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_580(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_582(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_581(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_583(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_582(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_584(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_583(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_585(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_584(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_586(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_585(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_587(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_586(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_588(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_587(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_589(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_588(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_590(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_589(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_591(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_590(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_592(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_591(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_593(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_592(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_594(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_593(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_595(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_594(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_596(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_595(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_597(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_596(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_598(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_597(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_599(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_598(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_600(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_599(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_601(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_600(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_602(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_601(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_603(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_602(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_604(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_603(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_605(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_604(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_606(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_605(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_607(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_606(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_608(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_607(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_609(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_608(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_610(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_609(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_611(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_610(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_612(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_611(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_613(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_612(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_614(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_613(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_615(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_614(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_616(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_615(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_617(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_616(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_618(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_617(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_619(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_618(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_620(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_619(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_621(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_620(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_622(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_621(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_623(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_622(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_624(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_623(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_625(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_624(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_626(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_625(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_627(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_626(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_628(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_627(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_629(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_628(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_630(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_629(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_631(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_630(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_632(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_631(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_633(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_632(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_634(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_633(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_635(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_634(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_636(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_635(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_637(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_636(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_638(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_637(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_639(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_638(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_640(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_639(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_641(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_640(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_642(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_641(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_643(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_642(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_644(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_643(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_645(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_644(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_646(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_645(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_647(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_646(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_648(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_647(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_649(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_648(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_650(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_649(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_651(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_650(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_652(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_651(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_653(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_652(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_654(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_653(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_655(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_654(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_656(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_655(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_657(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_656(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_658(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_657(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_659(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_658(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_660(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_659(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_661(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_660(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_662(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_661(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_663(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_662(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_664(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_663(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_665(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_664(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_666(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_665(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_667(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_666(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_668(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_667(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_669(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_668(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_670(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_669(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_671(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_670(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_672(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_671(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_673(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_672(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_674(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_673(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_675(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_674(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_676(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_675(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_677(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_676(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_678(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_677(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_679(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_678(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_680(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_679(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_681(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_680(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_682(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_681(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_683(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_682(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_684(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_683(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_685(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_684(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_686(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_685(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_687(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_686(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_688(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_687(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_689(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_688(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_690(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_689(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_691(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_690(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_692(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_691(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_693(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_692(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_694(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_693(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_695(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_694(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_696(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_695(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_697(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_696(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_698(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_697(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_699(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_698(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_700(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_699(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_701(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_700(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_702(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_701(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_703(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_702(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_704(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_703(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_705(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_704(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_706(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_705(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_707(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_706(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_708(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_707(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_709(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_708(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_710(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_709(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_711(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_710(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_712(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_711(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_713(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_712(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_714(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_713(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_715(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_714(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_716(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_715(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_717(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_716(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_718(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_717(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_719(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_718(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_720(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_719(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_721(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_720(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_722(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_721(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_723(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_722(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_724(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_723(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_725(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_724(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_726(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_725(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_727(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_726(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_728(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_727(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_729(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_728(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_730(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_729(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_731(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_730(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_732(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_731(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_733(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_732(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_734(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_733(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_735(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_734(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_736(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_735(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_737(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_736(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_738(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_737(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_739(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_738(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_740(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_739(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_741(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_740(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_742(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_741(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_743(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_742(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_744(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_743(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_745(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_744(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_746(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_745(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_747(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_746(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_748(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_747(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_749(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_748(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_750(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_749(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_751(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_750(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_752(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_751(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_753(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_752(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_754(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_753(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_755(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_754(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_756(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_755(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_757(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_756(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_758(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_757(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_759(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_758(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_760(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_759(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_761(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_760(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_762(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_761(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_763(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_762(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_764(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_763(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_765(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_764(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_766(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_765(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_767(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_766(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_768(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_767(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_769(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_768(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_770(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_769(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_771(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_770(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_772(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_771(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_773(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_772(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_774(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_773(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_775(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_774(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_776(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_775(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_777(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_776(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_778(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_777(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_779(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_778(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_780(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_779(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_781(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_780(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_782(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_781(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_783(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_782(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_784(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_783(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_785(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_784(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_786(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_785(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_787(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_786(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_788(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_787(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_789(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_788(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_790(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_789(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_791(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_790(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_792(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_791(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_793(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_792(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_794(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_793(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_795(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_794(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_796(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_795(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_797(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_796(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_798(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_797(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_799(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_798(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_800(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_799(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_801(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_800(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_802(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_801(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_803(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_802(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_804(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_803(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_805(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_804(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_806(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_805(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_807(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_806(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_808(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_807(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_809(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_808(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_810(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_809(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_811(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_810(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_812(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_811(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_813(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_812(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_814(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_813(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_815(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_814(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_816(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_815(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_817(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_816(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_818(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_817(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_819(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_818(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_820(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_819(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_821(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_820(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_822(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_821(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_823(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_822(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_824(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_823(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_825(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_824(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_826(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_825(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_827(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_826(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_828(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_827(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_829(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_828(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_830(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_829(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_831(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_830(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_832(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_831(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_833(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_832(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_834(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_833(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_835(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_834(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_836(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_835(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_837(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_836(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_838(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_837(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_839(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_838(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_840(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_839(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_841(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_840(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_842(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_841(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_843(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_842(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_844(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_843(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_845(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_844(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_846(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_845(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_847(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_846(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_848(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_847(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_849(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_848(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_850(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_849(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_851(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_850(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_852(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_851(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_853(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_852(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_854(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_853(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_855(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_854(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_856(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_855(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_857(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_856(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_858(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_857(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_859(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_858(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_860(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_859(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_861(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_860(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_862(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_861(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_863(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_862(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_864(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_863(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_865(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_864(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_866(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_865(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_867(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_866(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_868(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_867(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_869(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_868(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_870(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_869(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_871(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_870(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_872(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_871(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_873(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_872(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_874(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_873(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_875(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_874(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_876(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_875(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_877(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_876(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_878(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_877(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_879(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_878(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_880(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_879(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_881(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_880(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_882(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_881(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_883(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_882(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_884(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_883(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_885(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_884(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_886(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_885(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_887(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_886(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_888(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_887(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_889(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_888(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_890(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_889(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_891(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_890(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_892(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_891(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_893(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_892(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_894(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_893(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_895(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_894(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_896(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_895(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_897(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_896(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_898(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_897(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_899(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_898(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_900(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_899(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_901(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_900(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_902(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_901(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_903(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_902(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_904(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_903(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_905(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_904(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_906(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_905(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_907(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_906(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_908(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_907(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_909(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_908(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_910(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_909(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_911(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_910(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_912(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_911(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_913(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_912(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_914(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_913(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_915(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_914(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_916(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_915(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_917(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_916(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_918(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_917(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_919(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_918(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_920(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_919(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_921(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_920(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_922(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_921(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_923(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_922(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_924(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_923(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_925(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_924(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_926(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_925(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_927(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_926(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_928(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_927(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_929(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_928(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_930(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_929(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_931(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_930(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_932(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_931(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_933(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_932(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_934(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_933(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_935(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_934(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_936(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_935(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_937(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_936(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_938(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_937(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_939(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_938(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_940(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_939(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_941(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_940(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_942(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_941(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_943(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_942(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_944(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_943(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_945(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_944(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_946(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_945(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_947(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_946(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_948(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_947(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_949(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_948(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_950(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_949(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_951(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_950(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_952(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_951(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_953(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_952(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_954(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_953(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_955(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_954(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_956(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_955(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_957(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_956(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_958(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_957(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_959(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_958(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_960(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_959(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_961(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_960(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_962(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_961(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_963(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_962(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_964(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_963(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_965(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_964(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_966(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_965(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_967(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_966(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_968(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_967(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_969(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_968(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_970(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_969(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_971(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_970(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_972(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_971(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_973(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_972(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_974(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_973(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_975(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_974(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_976(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_975(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_977(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_976(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_978(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_977(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_979(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_978(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_980(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_979(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_981(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_980(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_982(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_981(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_983(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_982(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_984(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_983(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_985(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_984(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_986(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_985(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_987(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_986(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_988(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_987(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_989(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_988(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_990(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_989(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_991(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_990(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_992(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_991(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_993(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_992(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_994(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_993(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_995(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_994(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_996(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_995(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_997(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_996(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_998(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_997(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_999(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_998(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1000(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_999(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1001(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1000(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1002(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1001(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1003(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1002(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1004(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1003(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1005(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1004(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1006(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1005(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1007(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1006(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1008(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1007(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1009(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1008(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1010(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1009(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1011(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1010(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1012(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1011(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1013(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1012(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1014(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1013(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1015(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1014(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1016(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1015(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1017(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1016(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1018(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1017(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1019(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1018(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1020(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1019(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1021(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1020(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1022(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1021(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1023(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1022(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+#define TRLC_APPEND_1024(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_1023(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)
+
+
+// clang-format on
+
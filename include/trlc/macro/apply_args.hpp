@@ -0,0 +1,1058 @@
+
+
+/**
+ * This file is automatically generated from a Python script.
+ * 
+ * If you wish to change the number of recursive argument expansions or the output directory,
+ * please rerun the script and replace this file with the newly generated version.
+ * 
+ * Note: Modifications made directly to this file will be overwritten
+ * the next time the script is executed.
+ * 
+ * To run the script, use the following command:
+ * 
+ *     python3 macro_expansion_generator.py <N> [directory]
+ * 
+ * Where <N> is the number of recursive expansions you want (e.g., 125).
+ * [directory] is optional and specifies the output directory for the generated files.
+ */
+#pragma once
+
+// clang-format off
+
+#include "count_args.hpp"
+
+// Macro to apply a function to each argument
+#define TRLC_APPLY(MACRO, ...) TRLC_APPLY_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
+#define TRLC_APPLY_IMPL(MACRO, COUNT, ...) TRLC_APPLY_IMPL2(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_APPLY_IMPL2(MACRO, COUNT, ...) TRLC_APPLY_##COUNT(MACRO, __VA_ARGS__)
+
+// Recursive apply of arguments based on count
+#define TRLC_APPLY_1(MACRO, arg1) MACRO(arg1);
+#define TRLC_APPLY_2(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_3(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_2(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_4(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_3(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_5(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_4(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_6(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_5(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_7(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_6(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_8(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_7(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_9(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_8(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_10(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_9(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_11(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_10(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_12(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_11(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_13(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_12(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_14(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_13(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_15(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_14(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_16(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_15(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_17(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_16(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_18(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_17(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_19(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_18(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_20(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_19(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_21(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_20(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_22(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_21(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_23(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_22(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_24(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_23(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_25(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_24(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_26(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_25(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_27(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_26(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_28(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_27(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_29(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_28(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_30(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_29(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_31(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_30(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_32(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_31(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_33(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_32(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_34(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_33(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_35(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_34(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_36(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_35(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_37(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_36(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_38(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_37(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_39(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_38(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_40(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_39(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_41(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_40(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_42(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_41(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_43(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_42(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_44(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_43(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_45(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_44(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_46(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_45(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_47(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_46(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_48(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_47(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_49(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_48(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_50(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_49(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_51(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_50(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_52(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_51(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_53(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_52(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_54(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_53(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_55(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_54(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_56(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_55(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_57(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_56(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_58(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_57(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_59(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_58(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_60(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_59(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_61(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_60(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_62(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_61(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_63(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_62(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_64(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_63(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_65(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_64(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_66(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_65(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_67(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_66(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_68(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_67(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_69(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_68(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_70(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_69(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_71(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_70(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_72(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_71(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_73(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_72(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_74(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_73(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_75(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_74(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_76(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_75(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_77(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_76(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_78(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_77(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_79(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_78(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_80(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_79(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_81(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_80(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_82(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_81(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_83(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_82(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_84(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_83(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_85(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_84(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_86(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_85(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_87(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_86(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_88(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_87(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_89(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_88(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_90(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_89(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_91(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_90(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_92(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_91(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_93(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_92(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_94(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_93(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_95(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_94(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_96(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_95(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_97(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_96(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_98(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_97(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_99(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_98(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_100(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_99(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_101(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_100(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_102(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_101(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_103(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_102(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_104(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_103(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_105(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_104(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_106(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_105(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_107(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_106(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_108(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_107(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_109(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_108(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_110(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_109(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_111(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_110(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_112(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_111(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_113(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_112(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_114(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_113(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_115(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_114(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_116(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_115(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_117(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_116(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_118(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_117(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_119(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_118(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_120(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_119(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_121(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_120(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_122(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_121(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_123(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_122(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_124(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_123(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_125(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_124(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_126(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_125(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_127(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_126(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_128(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_127(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_129(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_128(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_130(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_129(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_131(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_130(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_132(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_131(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_133(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_132(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_134(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_133(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_135(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_134(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_136(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_135(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_137(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_136(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_138(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_137(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_139(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_138(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_140(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_139(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_141(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_140(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_142(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_141(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_143(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_142(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_144(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_143(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_145(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_144(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_146(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_145(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_147(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_146(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_148(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_147(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_149(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_148(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_150(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_149(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_151(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_150(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_152(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_151(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_153(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_152(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_154(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_153(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_155(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_154(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_156(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_155(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_157(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_156(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_158(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_157(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_159(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_158(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_160(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_159(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_161(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_160(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_162(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_161(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_163(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_162(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_164(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_163(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_165(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_164(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_166(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_165(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_167(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_166(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_168(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_167(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_169(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_168(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_170(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_169(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_171(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_170(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_172(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_171(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_173(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_172(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_174(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_173(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_175(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_174(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_176(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_175(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_177(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_176(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_178(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_177(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_179(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_178(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_180(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_179(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_181(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_180(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_182(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_181(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_183(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_182(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_184(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_183(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_185(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_184(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_186(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_185(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_187(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_186(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_188(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_187(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_189(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_188(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_190(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_189(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_191(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_190(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_192(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_191(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_193(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_192(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_194(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_193(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_195(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_194(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_196(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_195(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_197(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_196(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_198(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_197(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_199(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_198(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_200(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_199(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_201(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_200(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_202(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_201(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_203(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_202(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_204(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_203(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_205(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_204(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_206(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_205(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_207(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_206(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_208(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_207(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_209(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_208(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_210(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_209(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_211(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_210(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_212(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_211(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_213(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_212(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_214(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_213(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_215(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_214(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_216(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_215(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_217(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_216(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_218(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_217(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_219(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_218(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_220(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_219(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_221(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_220(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_222(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_221(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_223(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_222(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_224(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_223(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_225(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_224(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_226(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_225(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_227(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_226(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_228(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_227(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_229(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_228(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_230(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_229(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_231(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_230(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_232(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_231(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_233(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_232(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_234(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_233(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_235(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_234(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_236(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_235(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_237(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_236(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_238(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_237(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_239(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_238(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_240(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_239(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_241(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_240(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_242(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_241(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_243(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_242(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_244(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_243(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_245(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_244(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_246(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_245(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_247(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_246(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_248(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_247(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_249(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_248(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_250(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_249(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_251(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_250(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_252(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_251(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_253(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_252(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_254(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_253(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_255(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_254(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_256(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_255(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_257(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_256(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_258(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_257(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_259(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_258(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_260(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_259(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_261(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_260(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_262(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_261(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_263(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_262(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_264(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_263(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_265(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_264(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_266(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_265(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_267(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_266(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_268(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_267(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_269(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_268(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_270(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_269(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_271(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_270(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_272(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_271(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_273(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_272(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_274(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_273(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_275(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_274(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_276(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_275(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_277(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_276(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_278(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_277(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_279(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_278(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_280(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_279(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_281(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_280(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_282(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_281(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_283(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_282(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_284(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_283(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_285(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_284(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_286(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_285(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_287(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_286(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_288(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_287(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_289(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_288(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_290(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_289(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_291(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_290(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_292(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_291(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_293(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_292(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_294(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_293(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_295(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_294(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_296(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_295(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_297(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_296(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_298(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_297(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_299(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_298(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_300(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_299(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_301(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_300(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_302(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_301(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_303(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_302(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_304(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_303(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_305(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_304(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_306(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_305(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_307(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_306(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_308(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_307(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_309(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_308(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_310(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_309(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_311(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_310(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_312(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_311(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_313(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_312(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_314(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_313(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_315(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_314(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_316(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_315(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_317(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_316(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_318(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_317(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_319(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_318(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_320(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_319(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_321(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_320(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_322(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_321(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_323(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_322(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_324(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_323(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_325(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_324(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_326(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_325(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_327(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_326(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_328(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_327(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_329(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_328(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_330(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_329(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_331(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_330(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_332(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_331(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_333(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_332(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_334(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_333(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_335(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_334(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_336(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_335(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_337(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_336(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_338(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_337(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_339(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_338(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_340(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_339(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_341(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_340(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_342(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_341(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_343(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_342(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_344(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_343(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_345(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_344(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_346(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_345(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_347(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_346(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_348(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_347(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_349(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_348(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_350(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_349(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_351(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_350(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_352(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_351(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_353(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_352(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_354(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_353(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_355(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_354(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_356(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_355(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_357(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_356(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_358(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_357(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_359(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_358(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_360(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_359(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_361(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_360(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_362(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_361(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_363(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_362(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_364(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_363(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_365(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_364(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_366(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_365(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_367(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_366(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_368(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_367(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_369(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_368(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_370(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_369(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_371(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_370(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_372(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_371(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_373(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_372(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_374(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_373(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_375(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_374(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_376(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_375(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_377(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_376(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_378(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_377(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_379(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_378(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_380(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_379(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_381(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_380(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_382(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_381(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_383(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_382(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_384(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_383(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_385(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_384(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_386(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_385(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_387(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_386(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_388(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_387(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_389(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_388(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_390(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_389(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_391(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_390(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_392(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_391(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_393(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_392(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_394(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_393(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_395(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_394(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_396(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_395(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_397(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_396(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_398(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_397(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_399(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_398(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_400(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_399(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_401(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_400(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_402(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_401(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_403(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_402(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_404(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_403(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_405(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_404(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_406(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_405(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_407(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_406(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_408(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_407(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_409(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_408(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_410(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_409(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_411(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_410(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_412(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_411(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_413(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_412(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_414(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_413(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_415(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_414(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_416(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_415(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_417(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_416(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_418(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_417(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_419(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_418(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_420(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_419(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_421(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_420(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_422(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_421(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_423(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_422(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_424(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_423(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_425(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_424(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_426(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_425(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_427(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_426(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_428(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_427(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_429(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_428(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_430(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_429(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_431(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_430(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_432(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_431(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_433(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_432(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_434(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_433(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_435(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_434(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_436(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_435(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_437(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_436(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_438(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_437(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_439(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_438(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_440(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_439(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_441(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_440(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_442(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_441(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_443(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_442(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_444(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_443(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_445(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_444(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_446(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_445(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_447(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_446(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_448(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_447(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_449(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_448(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_450(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_449(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_451(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_450(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_452(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_451(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_453(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_452(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_454(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_453(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_455(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_454(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_456(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_455(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_457(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_456(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_458(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_457(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_459(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_458(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_460(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_459(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_461(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_460(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_462(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_461(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_463(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_462(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_464(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_463(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_465(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_464(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_466(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_465(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_467(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_466(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_468(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_467(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_469(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_468(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_470(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_469(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_471(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_470(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_472(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_471(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_473(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_472(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_474(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_473(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_475(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_474(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_476(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_475(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_477(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_476(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_478(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_477(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_479(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_478(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_480(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_479(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_481(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_480(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_482(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_481(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_483(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_482(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_484(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_483(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_485(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_484(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_486(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_485(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_487(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_486(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_488(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_487(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_489(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_488(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_490(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_489(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_491(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_490(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_492(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_491(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_493(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_492(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_494(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_493(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_495(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_494(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_496(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_495(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_497(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_496(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_498(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_497(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_499(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_498(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_500(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_499(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_501(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_500(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_502(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_501(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_503(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_502(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_504(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_503(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_505(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_504(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_506(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_505(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_507(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_506(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_508(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_507(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_509(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_508(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_510(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_509(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_511(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_510(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_512(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_511(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_513(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_512(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_514(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_513(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_515(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_514(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_516(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_515(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_517(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_516(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_518(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_517(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_519(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_518(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_520(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_519(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_521(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_520(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_522(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_521(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_523(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_522(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_524(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_523(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_525(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_524(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_526(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_525(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_527(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_526(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_528(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_527(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_529(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_528(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_530(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_529(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_531(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_530(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_532(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_531(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_533(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_532(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_534(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_533(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_535(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_534(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_536(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_535(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_537(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_536(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_538(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_537(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_539(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_538(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_540(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_539(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_541(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_540(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_542(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_541(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_543(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_542(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_544(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_543(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_545(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_544(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_546(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_545(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_547(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_546(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_548(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_547(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_549(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_548(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_550(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_549(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_551(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_550(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_552(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_551(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_553(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_552(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_554(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_553(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_555(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_554(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_556(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_555(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_557(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_556(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_558(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_557(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_559(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_558(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_560(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_559(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_561(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_560(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_562(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_561(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_563(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_562(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_564(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_563(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_565(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_564(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_566(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_565(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_567(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_566(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_568(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_567(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_569(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_568(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_570(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_569(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_571(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_570(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_572(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_571(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_573(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_572(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_574(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_573(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_575(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_574(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_576(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_575(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_577(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_576(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_578(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_577(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_579(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_578(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_580(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_579(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_581(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_580(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_582(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_581(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_583(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_582(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_584(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_583(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_585(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_584(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_586(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_585(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_587(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_586(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_588(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_587(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_589(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_588(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_590(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_589(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_591(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_590(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_592(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_591(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_593(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_592(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_594(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_593(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_595(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_594(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_596(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_595(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_597(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_596(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_598(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_597(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_599(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_598(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_600(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_599(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_601(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_600(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_602(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_601(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_603(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_602(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_604(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_603(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_605(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_604(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_606(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_605(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_607(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_606(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_608(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_607(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_609(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_608(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_610(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_609(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_611(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_610(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_612(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_611(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_613(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_612(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_614(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_613(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_615(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_614(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_616(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_615(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_617(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_616(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_618(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_617(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_619(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_618(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_620(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_619(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_621(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_620(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_622(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_621(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_623(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_622(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_624(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_623(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_625(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_624(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_626(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_625(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_627(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_626(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_628(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_627(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_629(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_628(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_630(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_629(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_631(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_630(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_632(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_631(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_633(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_632(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_634(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_633(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_635(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_634(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_636(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_635(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_637(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_636(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_638(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_637(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_639(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_638(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_640(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_639(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_641(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_640(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_642(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_641(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_643(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_642(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_644(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_643(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_645(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_644(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_646(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_645(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_647(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_646(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_648(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_647(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_649(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_648(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_650(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_649(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_651(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_650(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_652(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_651(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_653(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_652(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_654(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_653(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_655(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_654(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_656(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_655(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_657(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_656(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_658(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_657(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_659(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_658(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_660(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_659(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_661(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_660(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_662(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_661(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_663(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_662(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_664(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_663(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_665(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_664(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_666(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_665(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_667(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_666(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_668(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_667(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_669(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_668(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_670(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_669(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_671(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_670(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_672(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_671(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_673(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_672(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_674(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_673(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_675(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_674(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_676(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_675(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_677(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_676(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_678(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_677(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_679(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_678(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_680(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_679(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_681(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_680(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_682(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_681(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_683(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_682(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_684(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_683(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_685(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_684(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_686(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_685(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_687(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_686(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_688(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_687(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_689(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_688(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_690(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_689(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_691(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_690(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_692(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_691(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_693(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_692(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_694(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_693(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_695(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_694(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_696(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_695(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_697(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_696(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_698(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_697(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_699(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_698(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_700(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_699(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_701(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_700(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_702(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_701(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_703(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_702(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_704(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_703(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_705(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_704(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_706(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_705(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_707(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_706(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_708(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_707(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_709(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_708(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_710(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_709(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_711(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_710(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_712(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_711(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_713(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_712(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_714(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_713(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_715(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_714(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_716(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_715(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_717(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_716(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_718(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_717(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_719(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_718(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_720(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_719(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_721(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_720(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_722(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_721(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_723(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_722(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_724(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_723(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_725(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_724(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_726(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_725(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_727(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_726(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_728(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_727(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_729(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_728(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_730(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_729(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_731(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_730(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_732(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_731(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_733(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_732(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_734(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_733(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_735(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_734(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_736(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_735(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_737(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_736(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_738(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_737(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_739(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_738(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_740(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_739(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_741(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_740(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_742(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_741(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_743(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_742(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_744(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_743(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_745(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_744(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_746(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_745(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_747(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_746(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_748(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_747(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_749(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_748(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_750(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_749(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_751(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_750(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_752(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_751(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_753(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_752(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_754(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_753(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_755(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_754(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_756(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_755(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_757(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_756(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_758(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_757(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_759(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_758(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_760(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_759(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_761(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_760(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_762(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_761(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_763(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_762(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_764(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_763(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_765(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_764(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_766(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_765(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_767(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_766(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_768(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_767(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_769(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_768(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_770(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_769(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_771(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_770(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_772(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_771(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_773(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_772(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_774(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_773(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_775(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_774(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_776(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_775(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_777(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_776(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_778(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_777(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_779(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_778(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_780(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_779(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_781(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_780(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_782(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_781(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_783(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_782(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_784(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_783(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_785(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_784(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_786(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_785(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_787(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_786(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_788(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_787(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_789(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_788(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_790(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_789(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_791(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_790(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_792(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_791(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_793(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_792(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_794(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_793(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_795(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_794(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_796(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_795(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_797(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_796(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_798(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_797(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_799(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_798(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_800(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_799(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_801(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_800(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_802(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_801(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_803(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_802(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_804(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_803(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_805(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_804(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_806(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_805(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_807(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_806(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_808(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_807(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_809(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_808(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_810(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_809(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_811(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_810(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_812(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_811(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_813(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_812(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_814(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_813(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_815(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_814(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_816(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_815(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_817(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_816(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_818(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_817(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_819(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_818(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_820(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_819(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_821(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_820(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_822(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_821(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_823(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_822(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_824(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_823(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_825(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_824(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_826(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_825(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_827(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_826(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_828(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_827(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_829(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_828(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_830(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_829(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_831(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_830(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_832(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_831(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_833(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_832(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_834(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_833(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_835(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_834(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_836(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_835(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_837(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_836(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_838(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_837(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_839(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_838(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_840(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_839(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_841(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_840(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_842(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_841(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_843(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_842(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_844(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_843(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_845(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_844(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_846(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_845(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_847(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_846(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_848(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_847(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_849(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_848(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_850(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_849(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_851(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_850(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_852(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_851(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_853(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_852(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_854(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_853(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_855(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_854(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_856(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_855(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_857(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_856(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_858(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_857(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_859(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_858(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_860(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_859(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_861(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_860(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_862(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_861(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_863(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_862(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_864(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_863(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_865(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_864(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_866(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_865(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_867(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_866(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_868(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_867(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_869(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_868(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_870(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_869(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_871(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_870(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_872(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_871(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_873(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_872(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_874(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_873(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_875(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_874(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_876(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_875(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_877(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_876(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_878(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_877(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_879(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_878(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_880(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_879(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_881(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_880(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_882(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_881(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_883(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_882(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_884(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_883(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_885(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_884(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_886(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_885(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_887(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_886(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_888(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_887(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_889(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_888(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_890(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_889(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_891(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_890(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_892(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_891(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_893(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_892(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_894(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_893(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_895(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_894(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_896(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_895(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_897(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_896(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_898(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_897(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_899(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_898(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_900(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_899(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_901(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_900(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_902(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_901(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_903(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_902(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_904(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_903(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_905(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_904(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_906(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_905(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_907(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_906(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_908(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_907(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_909(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_908(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_910(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_909(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_911(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_910(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_912(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_911(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_913(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_912(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_914(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_913(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_915(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_914(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_916(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_915(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_917(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_916(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_918(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_917(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_919(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_918(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_920(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_919(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_921(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_920(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_922(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_921(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_923(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_922(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_924(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_923(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_925(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_924(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_926(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_925(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_927(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_926(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_928(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_927(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_929(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_928(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_930(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_929(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_931(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_930(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_932(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_931(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_933(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_932(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_934(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_933(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_935(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_934(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_936(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_935(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_937(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_936(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_938(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_937(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_939(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_938(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_940(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_939(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_941(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_940(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_942(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_941(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_943(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_942(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_944(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_943(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_945(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_944(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_946(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_945(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_947(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_946(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_948(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_947(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_949(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_948(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_950(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_949(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_951(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_950(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_952(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_951(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_953(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_952(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_954(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_953(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_955(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_954(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_956(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_955(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_957(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_956(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_958(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_957(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_959(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_958(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_960(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_959(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_961(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_960(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_962(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_961(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_963(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_962(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_964(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_963(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_965(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_964(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_966(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_965(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_967(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_966(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_968(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_967(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_969(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_968(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_970(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_969(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_971(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_970(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_972(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_971(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_973(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_972(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_974(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_973(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_975(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_974(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_976(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_975(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_977(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_976(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_978(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_977(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_979(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_978(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_980(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_979(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_981(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_980(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_982(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_981(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_983(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_982(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_984(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_983(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_985(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_984(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_986(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_985(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_987(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_986(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_988(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_987(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_989(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_988(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_990(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_989(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_991(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_990(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_992(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_991(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_993(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_992(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_994(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_993(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_995(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_994(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_996(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_995(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_997(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_996(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_998(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_997(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_999(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_998(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1000(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_999(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1001(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1000(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1002(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1001(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1003(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1002(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1004(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1003(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1005(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1004(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1006(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1005(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1007(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1006(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1008(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1007(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1009(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1008(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1010(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1009(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1011(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1010(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1012(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1011(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1013(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1012(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1014(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1013(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1015(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1014(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1016(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1015(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1017(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1016(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1018(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1017(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1019(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1018(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1020(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1019(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1021(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1020(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1022(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1021(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1023(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1022(MACRO, __VA_ARGS__)
+#define TRLC_APPLY_1024(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_1023(MACRO, __VA_ARGS__)
+
+
+// clang-format on
+
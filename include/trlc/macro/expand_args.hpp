@@ -0,0 +1,1058 @@
+
+
+/**
+ * This file is automatically generated from a Python script.
+ * 
+ * If you wish to change the number of recursive argument expansions or the output directory,
+ * please rerun the script and replace this file with the newly generated version.
+ * 
+ * Note: Modifications made directly to this file will be overwritten
+ * the next time the script is executed.
+ * 
+ * To run the script, use the following command:
+ * 
+ *     python3 macro_expansion_generator.py <N> [directory]
+ * 
+ * Where <N> is the number of recursive expansions you want (e.g., 125).
+ * [directory] is optional and specifies the output directory for the generated files.
+ */
+#pragma once
+
+// clang-format off
+
+#include "count_args.hpp"
+
+// Macro to expand a expr to each argument
+#define TRLC_EXPAND(MACRO, ...) TRLC_EXPAND_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
+#define TRLC_EXPAND_IMPL(MACRO, COUNT, ...) TRLC_EXPAND_IMPL2(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_IMPL2(MACRO, COUNT, ...) TRLC_EXPAND_##COUNT(MACRO, __VA_ARGS__)
+
+// Recursive expansion of arguments based on count
+#define TRLC_EXPAND_1(MACRO, arg1) MACRO(arg1)
+#define TRLC_EXPAND_2(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_3(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_2(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_4(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_3(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_5(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_4(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_6(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_5(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_7(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_6(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_8(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_7(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_9(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_8(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_10(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_9(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_11(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_10(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_12(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_11(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_13(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_12(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_14(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_13(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_15(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_14(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_16(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_15(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_17(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_16(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_18(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_17(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_19(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_18(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_20(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_19(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_21(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_20(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_22(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_21(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_23(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_22(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_24(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_23(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_25(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_24(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_26(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_25(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_27(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_26(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_28(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_27(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_29(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_28(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_30(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_29(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_31(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_30(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_32(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_31(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_33(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_32(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_34(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_33(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_35(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_34(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_36(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_35(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_37(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_36(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_38(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_37(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_39(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_38(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_40(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_39(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_41(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_40(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_42(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_41(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_43(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_42(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_44(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_43(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_45(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_44(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_46(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_45(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_47(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_46(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_48(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_47(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_49(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_48(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_50(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_49(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_51(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_50(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_52(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_51(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_53(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_52(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_54(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_53(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_55(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_54(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_56(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_55(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_57(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_56(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_58(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_57(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_59(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_58(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_60(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_59(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_61(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_60(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_62(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_61(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_63(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_62(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_64(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_63(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_65(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_64(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_66(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_65(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_67(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_66(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_68(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_67(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_69(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_68(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_70(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_69(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_71(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_70(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_72(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_71(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_73(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_72(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_74(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_73(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_75(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_74(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_76(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_75(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_77(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_76(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_78(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_77(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_79(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_78(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_80(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_79(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_81(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_80(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_82(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_81(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_83(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_82(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_84(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_83(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_85(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_84(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_86(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_85(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_87(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_86(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_88(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_87(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_89(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_88(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_90(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_89(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_91(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_90(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_92(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_91(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_93(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_92(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_94(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_93(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_95(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_94(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_96(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_95(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_97(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_96(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_98(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_97(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_99(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_98(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_100(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_99(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_101(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_100(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_102(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_101(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_103(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_102(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_104(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_103(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_105(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_104(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_106(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_105(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_107(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_106(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_108(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_107(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_109(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_108(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_110(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_109(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_111(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_110(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_112(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_111(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_113(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_112(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_114(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_113(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_115(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_114(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_116(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_115(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_117(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_116(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_118(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_117(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_119(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_118(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_120(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_119(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_121(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_120(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_122(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_121(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_123(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_122(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_124(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_123(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_125(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_124(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_126(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_125(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_127(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_126(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_128(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_127(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_129(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_128(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_130(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_129(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_131(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_130(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_132(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_131(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_133(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_132(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_134(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_133(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_135(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_134(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_136(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_135(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_137(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_136(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_138(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_137(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_139(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_138(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_140(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_139(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_141(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_140(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_142(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_141(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_143(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_142(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_144(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_143(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_145(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_144(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_146(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_145(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_147(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_146(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_148(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_147(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_149(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_148(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_150(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_149(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_151(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_150(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_152(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_151(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_153(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_152(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_154(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_153(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_155(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_154(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_156(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_155(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_157(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_156(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_158(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_157(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_159(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_158(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_160(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_159(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_161(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_160(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_162(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_161(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_163(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_162(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_164(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_163(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_165(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_164(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_166(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_165(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_167(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_166(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_168(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_167(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_169(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_168(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_170(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_169(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_171(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_170(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_172(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_171(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_173(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_172(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_174(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_173(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_175(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_174(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_176(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_175(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_177(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_176(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_178(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_177(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_179(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_178(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_180(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_179(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_181(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_180(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_182(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_181(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_183(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_182(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_184(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_183(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_185(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_184(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_186(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_185(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_187(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_186(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_188(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_187(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_189(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_188(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_190(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_189(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_191(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_190(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_192(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_191(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_193(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_192(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_194(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_193(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_195(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_194(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_196(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_195(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_197(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_196(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_198(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_197(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_199(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_198(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_200(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_199(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_201(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_200(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_202(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_201(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_203(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_202(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_204(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_203(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_205(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_204(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_206(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_205(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_207(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_206(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_208(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_207(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_209(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_208(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_210(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_209(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_211(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_210(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_212(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_211(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_213(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_212(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_214(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_213(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_215(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_214(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_216(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_215(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_217(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_216(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_218(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_217(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_219(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_218(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_220(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_219(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_221(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_220(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_222(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_221(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_223(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_222(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_224(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_223(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_225(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_224(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_226(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_225(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_227(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_226(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_228(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_227(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_229(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_228(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_230(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_229(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_231(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_230(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_232(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_231(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_233(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_232(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_234(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_233(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_235(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_234(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_236(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_235(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_237(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_236(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_238(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_237(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_239(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_238(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_240(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_239(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_241(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_240(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_242(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_241(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_243(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_242(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_244(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_243(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_245(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_244(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_246(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_245(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_247(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_246(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_248(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_247(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_249(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_248(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_250(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_249(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_251(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_250(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_252(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_251(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_253(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_252(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_254(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_253(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_255(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_254(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_256(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_255(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_257(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_256(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_258(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_257(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_259(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_258(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_260(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_259(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_261(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_260(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_262(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_261(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_263(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_262(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_264(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_263(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_265(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_264(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_266(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_265(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_267(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_266(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_268(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_267(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_269(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_268(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_270(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_269(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_271(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_270(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_272(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_271(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_273(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_272(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_274(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_273(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_275(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_274(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_276(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_275(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_277(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_276(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_278(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_277(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_279(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_278(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_280(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_279(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_281(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_280(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_282(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_281(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_283(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_282(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_284(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_283(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_285(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_284(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_286(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_285(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_287(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_286(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_288(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_287(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_289(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_288(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_290(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_289(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_291(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_290(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_292(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_291(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_293(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_292(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_294(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_293(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_295(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_294(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_296(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_295(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_297(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_296(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_298(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_297(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_299(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_298(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_300(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_299(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_301(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_300(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_302(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_301(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_303(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_302(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_304(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_303(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_305(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_304(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_306(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_305(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_307(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_306(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_308(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_307(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_309(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_308(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_310(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_309(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_311(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_310(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_312(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_311(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_313(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_312(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_314(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_313(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_315(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_314(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_316(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_315(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_317(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_316(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_318(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_317(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_319(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_318(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_320(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_319(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_321(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_320(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_322(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_321(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_323(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_322(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_324(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_323(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_325(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_324(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_326(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_325(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_327(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_326(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_328(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_327(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_329(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_328(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_330(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_329(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_331(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_330(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_332(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_331(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_333(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_332(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_334(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_333(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_335(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_334(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_336(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_335(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_337(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_336(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_338(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_337(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_339(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_338(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_340(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_339(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_341(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_340(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_342(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_341(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_343(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_342(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_344(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_343(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_345(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_344(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_346(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_345(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_347(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_346(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_348(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_347(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_349(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_348(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_350(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_349(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_351(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_350(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_352(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_351(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_353(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_352(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_354(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_353(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_355(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_354(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_356(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_355(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_357(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_356(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_358(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_357(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_359(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_358(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_360(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_359(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_361(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_360(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_362(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_361(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_363(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_362(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_364(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_363(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_365(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_364(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_366(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_365(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_367(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_366(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_368(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_367(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_369(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_368(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_370(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_369(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_371(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_370(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_372(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_371(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_373(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_372(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_374(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_373(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_375(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_374(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_376(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_375(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_377(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_376(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_378(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_377(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_379(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_378(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_380(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_379(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_381(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_380(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_382(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_381(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_383(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_382(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_384(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_383(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_385(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_384(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_386(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_385(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_387(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_386(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_388(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_387(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_389(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_388(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_390(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_389(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_391(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_390(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_392(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_391(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_393(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_392(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_394(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_393(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_395(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_394(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_396(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_395(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_397(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_396(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_398(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_397(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_399(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_398(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_400(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_399(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_401(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_400(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_402(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_401(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_403(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_402(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_404(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_403(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_405(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_404(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_406(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_405(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_407(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_406(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_408(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_407(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_409(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_408(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_410(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_409(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_411(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_410(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_412(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_411(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_413(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_412(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_414(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_413(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_415(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_414(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_416(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_415(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_417(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_416(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_418(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_417(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_419(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_418(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_420(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_419(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_421(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_420(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_422(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_421(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_423(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_422(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_424(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_423(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_425(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_424(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_426(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_425(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_427(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_426(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_428(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_427(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_429(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_428(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_430(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_429(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_431(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_430(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_432(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_431(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_433(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_432(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_434(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_433(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_435(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_434(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_436(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_435(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_437(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_436(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_438(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_437(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_439(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_438(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_440(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_439(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_441(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_440(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_442(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_441(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_443(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_442(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_444(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_443(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_445(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_444(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_446(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_445(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_447(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_446(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_448(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_447(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_449(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_448(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_450(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_449(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_451(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_450(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_452(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_451(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_453(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_452(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_454(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_453(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_455(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_454(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_456(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_455(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_457(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_456(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_458(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_457(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_459(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_458(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_460(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_459(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_461(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_460(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_462(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_461(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_463(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_462(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_464(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_463(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_465(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_464(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_466(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_465(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_467(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_466(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_468(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_467(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_469(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_468(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_470(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_469(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_471(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_470(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_472(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_471(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_473(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_472(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_474(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_473(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_475(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_474(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_476(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_475(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_477(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_476(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_478(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_477(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_479(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_478(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_480(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_479(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_481(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_480(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_482(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_481(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_483(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_482(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_484(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_483(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_485(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_484(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_486(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_485(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_487(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_486(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_488(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_487(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_489(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_488(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_490(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_489(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_491(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_490(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_492(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_491(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_493(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_492(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_494(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_493(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_495(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_494(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_496(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_495(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_497(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_496(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_498(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_497(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_499(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_498(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_500(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_499(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_501(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_500(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_502(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_501(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_503(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_502(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_504(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_503(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_505(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_504(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_506(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_505(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_507(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_506(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_508(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_507(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_509(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_508(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_510(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_509(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_511(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_510(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_512(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_511(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_513(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_512(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_514(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_513(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_515(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_514(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_516(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_515(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_517(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_516(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_518(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_517(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_519(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_518(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_520(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_519(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_521(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_520(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_522(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_521(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_523(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_522(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_524(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_523(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_525(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_524(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_526(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_525(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_527(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_526(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_528(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_527(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_529(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_528(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_530(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_529(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_531(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_530(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_532(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_531(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_533(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_532(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_534(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_533(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_535(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_534(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_536(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_535(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_537(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_536(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_538(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_537(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_539(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_538(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_540(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_539(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_541(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_540(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_542(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_541(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_543(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_542(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_544(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_543(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_545(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_544(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_546(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_545(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_547(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_546(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_548(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_547(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_549(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_548(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_550(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_549(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_551(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_550(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_552(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_551(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_553(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_552(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_554(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_553(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_555(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_554(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_556(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_555(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_557(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_556(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_558(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_557(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_559(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_558(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_560(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_559(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_561(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_560(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_562(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_561(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_563(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_562(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_564(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_563(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_565(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_564(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_566(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_565(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_567(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_566(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_568(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_567(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_569(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_568(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_570(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_569(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_571(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_570(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_572(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_571(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_573(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_572(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_574(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_573(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_575(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_574(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_576(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_575(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_577(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_576(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_578(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_577(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_579(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_578(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_580(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_579(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_581(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_580(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_582(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_581(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_583(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_582(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_584(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_583(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_585(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_584(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_586(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_585(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_587(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_586(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_588(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_587(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_589(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_588(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_590(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_589(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_591(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_590(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_592(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_591(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_593(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_592(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_594(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_593(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_595(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_594(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_596(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_595(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_597(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_596(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_598(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_597(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_599(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_598(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_600(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_599(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_601(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_600(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_602(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_601(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_603(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_602(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_604(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_603(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_605(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_604(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_606(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_605(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_607(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_606(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_608(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_607(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_609(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_608(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_610(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_609(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_611(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_610(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_612(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_611(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_613(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_612(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_614(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_613(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_615(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_614(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_616(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_615(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_617(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_616(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_618(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_617(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_619(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_618(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_620(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_619(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_621(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_620(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_622(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_621(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_623(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_622(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_624(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_623(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_625(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_624(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_626(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_625(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_627(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_626(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_628(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_627(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_629(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_628(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_630(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_629(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_631(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_630(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_632(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_631(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_633(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_632(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_634(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_633(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_635(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_634(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_636(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_635(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_637(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_636(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_638(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_637(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_639(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_638(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_640(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_639(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_641(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_640(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_642(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_641(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_643(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_642(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_644(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_643(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_645(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_644(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_646(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_645(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_647(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_646(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_648(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_647(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_649(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_648(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_650(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_649(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_651(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_650(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_652(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_651(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_653(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_652(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_654(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_653(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_655(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_654(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_656(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_655(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_657(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_656(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_658(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_657(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_659(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_658(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_660(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_659(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_661(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_660(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_662(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_661(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_663(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_662(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_664(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_663(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_665(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_664(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_666(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_665(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_667(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_666(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_668(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_667(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_669(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_668(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_670(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_669(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_671(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_670(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_672(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_671(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_673(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_672(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_674(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_673(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_675(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_674(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_676(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_675(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_677(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_676(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_678(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_677(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_679(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_678(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_680(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_679(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_681(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_680(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_682(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_681(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_683(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_682(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_684(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_683(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_685(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_684(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_686(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_685(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_687(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_686(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_688(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_687(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_689(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_688(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_690(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_689(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_691(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_690(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_692(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_691(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_693(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_692(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_694(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_693(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_695(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_694(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_696(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_695(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_697(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_696(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_698(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_697(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_699(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_698(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_700(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_699(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_701(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_700(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_702(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_701(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_703(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_702(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_704(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_703(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_705(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_704(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_706(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_705(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_707(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_706(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_708(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_707(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_709(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_708(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_710(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_709(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_711(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_710(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_712(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_711(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_713(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_712(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_714(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_713(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_715(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_714(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_716(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_715(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_717(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_716(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_718(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_717(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_719(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_718(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_720(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_719(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_721(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_720(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_722(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_721(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_723(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_722(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_724(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_723(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_725(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_724(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_726(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_725(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_727(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_726(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_728(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_727(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_729(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_728(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_730(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_729(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_731(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_730(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_732(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_731(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_733(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_732(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_734(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_733(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_735(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_734(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_736(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_735(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_737(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_736(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_738(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_737(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_739(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_738(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_740(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_739(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_741(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_740(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_742(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_741(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_743(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_742(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_744(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_743(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_745(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_744(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_746(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_745(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_747(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_746(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_748(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_747(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_749(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_748(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_750(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_749(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_751(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_750(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_752(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_751(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_753(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_752(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_754(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_753(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_755(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_754(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_756(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_755(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_757(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_756(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_758(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_757(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_759(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_758(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_760(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_759(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_761(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_760(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_762(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_761(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_763(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_762(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_764(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_763(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_765(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_764(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_766(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_765(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_767(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_766(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_768(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_767(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_769(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_768(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_770(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_769(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_771(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_770(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_772(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_771(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_773(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_772(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_774(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_773(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_775(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_774(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_776(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_775(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_777(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_776(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_778(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_777(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_779(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_778(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_780(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_779(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_781(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_780(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_782(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_781(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_783(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_782(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_784(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_783(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_785(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_784(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_786(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_785(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_787(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_786(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_788(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_787(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_789(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_788(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_790(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_789(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_791(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_790(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_792(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_791(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_793(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_792(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_794(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_793(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_795(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_794(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_796(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_795(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_797(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_796(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_798(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_797(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_799(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_798(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_800(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_799(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_801(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_800(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_802(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_801(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_803(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_802(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_804(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_803(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_805(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_804(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_806(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_805(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_807(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_806(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_808(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_807(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_809(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_808(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_810(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_809(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_811(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_810(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_812(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_811(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_813(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_812(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_814(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_813(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_815(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_814(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_816(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_815(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_817(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_816(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_818(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_817(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_819(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_818(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_820(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_819(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_821(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_820(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_822(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_821(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_823(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_822(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_824(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_823(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_825(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_824(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_826(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_825(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_827(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_826(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_828(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_827(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_829(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_828(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_830(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_829(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_831(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_830(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_832(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_831(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_833(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_832(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_834(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_833(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_835(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_834(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_836(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_835(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_837(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_836(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_838(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_837(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_839(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_838(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_840(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_839(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_841(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_840(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_842(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_841(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_843(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_842(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_844(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_843(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_845(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_844(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_846(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_845(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_847(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_846(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_848(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_847(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_849(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_848(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_850(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_849(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_851(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_850(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_852(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_851(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_853(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_852(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_854(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_853(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_855(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_854(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_856(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_855(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_857(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_856(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_858(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_857(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_859(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_858(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_860(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_859(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_861(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_860(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_862(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_861(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_863(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_862(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_864(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_863(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_865(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_864(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_866(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_865(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_867(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_866(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_868(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_867(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_869(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_868(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_870(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_869(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_871(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_870(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_872(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_871(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_873(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_872(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_874(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_873(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_875(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_874(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_876(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_875(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_877(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_876(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_878(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_877(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_879(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_878(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_880(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_879(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_881(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_880(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_882(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_881(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_883(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_882(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_884(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_883(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_885(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_884(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_886(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_885(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_887(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_886(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_888(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_887(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_889(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_888(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_890(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_889(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_891(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_890(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_892(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_891(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_893(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_892(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_894(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_893(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_895(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_894(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_896(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_895(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_897(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_896(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_898(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_897(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_899(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_898(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_900(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_899(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_901(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_900(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_902(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_901(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_903(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_902(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_904(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_903(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_905(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_904(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_906(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_905(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_907(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_906(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_908(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_907(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_909(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_908(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_910(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_909(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_911(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_910(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_912(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_911(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_913(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_912(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_914(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_913(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_915(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_914(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_916(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_915(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_917(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_916(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_918(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_917(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_919(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_918(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_920(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_919(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_921(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_920(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_922(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_921(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_923(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_922(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_924(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_923(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_925(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_924(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_926(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_925(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_927(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_926(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_928(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_927(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_929(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_928(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_930(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_929(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_931(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_930(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_932(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_931(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_933(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_932(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_934(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_933(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_935(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_934(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_936(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_935(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_937(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_936(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_938(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_937(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_939(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_938(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_940(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_939(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_941(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_940(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_942(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_941(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_943(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_942(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_944(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_943(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_945(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_944(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_946(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_945(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_947(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_946(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_948(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_947(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_949(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_948(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_950(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_949(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_951(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_950(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_952(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_951(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_953(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_952(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_954(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_953(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_955(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_954(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_956(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_955(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_957(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_956(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_958(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_957(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_959(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_958(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_960(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_959(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_961(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_960(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_962(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_961(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_963(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_962(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_964(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_963(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_965(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_964(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_966(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_965(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_967(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_966(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_968(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_967(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_969(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_968(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_970(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_969(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_971(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_970(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_972(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_971(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_973(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_972(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_974(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_973(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_975(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_974(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_976(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_975(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_977(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_976(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_978(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_977(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_979(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_978(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_980(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_979(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_981(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_980(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_982(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_981(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_983(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_982(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_984(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_983(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_985(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_984(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_986(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_985(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_987(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_986(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_988(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_987(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_989(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_988(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_990(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_989(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_991(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_990(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_992(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_991(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_993(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_992(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_994(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_993(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_995(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_994(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_996(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_995(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_997(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_996(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_998(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_997(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_999(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_998(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1000(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_999(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1001(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1000(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1002(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1001(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1003(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1002(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1004(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1003(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1005(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1004(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1006(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1005(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1007(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1006(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1008(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1007(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1009(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1008(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1010(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1009(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1011(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1010(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1012(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1011(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1013(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1012(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1014(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1013(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1015(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1014(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1016(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1015(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1017(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1016(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1018(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1017(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1019(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1018(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1020(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1019(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1021(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1020(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1022(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1021(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1023(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1022(MACRO, __VA_ARGS__)
+#define TRLC_EXPAND_1024(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_1023(MACRO, __VA_ARGS__)
+
+
+// clang-format on
+
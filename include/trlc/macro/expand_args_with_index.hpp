@@ -0,0 +1,1057 @@
+
+
+/**
+ * This file is automatically generated from a Python script.
+ * 
+ * If you wish to change the number of recursive argument expansions or the output directory,
+ * please rerun the script and replace this file with the newly generated version.
+ * 
+ * Note: Modifications made directly to this file will be overwritten
+ * the next time the script is executed.
+ * 
+ * To run the script, use the following command:
+ * 
+ *     python3 macro_expansion_generator.py <N> [directory]
+ * 
+ * Where <N> is the number of recursive expansions you want (e.g., 125).
+ * [directory] is optional and specifies the output directory for the generated files.
+ */
+#pragma once
+
+// clang-format off
+
+#include "count_args.hpp"
+
+// Macro to expand a expr to each with index
+#define TRLC_EXPAND_WITH_INDEX(MACRO, ...) TRLC_EXPAND_WITH_INDEX_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_IMPL(MACRO, COUNT, ...) TRLC_EXPAND_WITH_INDEX_IMPL2(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_IMPL2(MACRO, COUNT, ...) TRLC_EXPAND_WITH_INDEX_##COUNT(MACRO, COUNT, __VA_ARGS__)
+
+// Recursive expansion of arguments based on count with index
+#define TRLC_EXPAND_WITH_INDEX_1(MACRO, COUNT, arg1) MACRO(arg1, (COUNT))
+#define TRLC_EXPAND_WITH_INDEX_2(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1)), TRLC_EXPAND_WITH_INDEX_1(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_3(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 2)), TRLC_EXPAND_WITH_INDEX_2(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_4(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 3)), TRLC_EXPAND_WITH_INDEX_3(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_5(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 4)), TRLC_EXPAND_WITH_INDEX_4(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_6(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 5)), TRLC_EXPAND_WITH_INDEX_5(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_7(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 6)), TRLC_EXPAND_WITH_INDEX_6(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_8(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 7)), TRLC_EXPAND_WITH_INDEX_7(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_9(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 8)), TRLC_EXPAND_WITH_INDEX_8(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_10(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 9)), TRLC_EXPAND_WITH_INDEX_9(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_11(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 10)), TRLC_EXPAND_WITH_INDEX_10(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_12(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 11)), TRLC_EXPAND_WITH_INDEX_11(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_13(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 12)), TRLC_EXPAND_WITH_INDEX_12(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_14(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 13)), TRLC_EXPAND_WITH_INDEX_13(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_15(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 14)), TRLC_EXPAND_WITH_INDEX_14(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_16(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 15)), TRLC_EXPAND_WITH_INDEX_15(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_17(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 16)), TRLC_EXPAND_WITH_INDEX_16(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_18(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 17)), TRLC_EXPAND_WITH_INDEX_17(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_19(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 18)), TRLC_EXPAND_WITH_INDEX_18(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_20(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 19)), TRLC_EXPAND_WITH_INDEX_19(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_21(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 20)), TRLC_EXPAND_WITH_INDEX_20(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_22(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 21)), TRLC_EXPAND_WITH_INDEX_21(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_23(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 22)), TRLC_EXPAND_WITH_INDEX_22(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_24(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 23)), TRLC_EXPAND_WITH_INDEX_23(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_25(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 24)), TRLC_EXPAND_WITH_INDEX_24(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_26(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 25)), TRLC_EXPAND_WITH_INDEX_25(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_27(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 26)), TRLC_EXPAND_WITH_INDEX_26(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_28(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 27)), TRLC_EXPAND_WITH_INDEX_27(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_29(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 28)), TRLC_EXPAND_WITH_INDEX_28(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_30(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 29)), TRLC_EXPAND_WITH_INDEX_29(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_31(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 30)), TRLC_EXPAND_WITH_INDEX_30(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_32(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 31)), TRLC_EXPAND_WITH_INDEX_31(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_33(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 32)), TRLC_EXPAND_WITH_INDEX_32(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_34(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 33)), TRLC_EXPAND_WITH_INDEX_33(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_35(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 34)), TRLC_EXPAND_WITH_INDEX_34(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_36(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 35)), TRLC_EXPAND_WITH_INDEX_35(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_37(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 36)), TRLC_EXPAND_WITH_INDEX_36(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_38(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 37)), TRLC_EXPAND_WITH_INDEX_37(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_39(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 38)), TRLC_EXPAND_WITH_INDEX_38(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_40(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 39)), TRLC_EXPAND_WITH_INDEX_39(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_41(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 40)), TRLC_EXPAND_WITH_INDEX_40(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_42(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 41)), TRLC_EXPAND_WITH_INDEX_41(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_43(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 42)), TRLC_EXPAND_WITH_INDEX_42(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_44(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 43)), TRLC_EXPAND_WITH_INDEX_43(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_45(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 44)), TRLC_EXPAND_WITH_INDEX_44(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_46(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 45)), TRLC_EXPAND_WITH_INDEX_45(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_47(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 46)), TRLC_EXPAND_WITH_INDEX_46(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_48(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 47)), TRLC_EXPAND_WITH_INDEX_47(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_49(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 48)), TRLC_EXPAND_WITH_INDEX_48(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_50(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 49)), TRLC_EXPAND_WITH_INDEX_49(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_51(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 50)), TRLC_EXPAND_WITH_INDEX_50(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_52(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 51)), TRLC_EXPAND_WITH_INDEX_51(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_53(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 52)), TRLC_EXPAND_WITH_INDEX_52(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_54(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 53)), TRLC_EXPAND_WITH_INDEX_53(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_55(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 54)), TRLC_EXPAND_WITH_INDEX_54(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_56(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 55)), TRLC_EXPAND_WITH_INDEX_55(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_57(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 56)), TRLC_EXPAND_WITH_INDEX_56(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_58(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 57)), TRLC_EXPAND_WITH_INDEX_57(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_59(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 58)), TRLC_EXPAND_WITH_INDEX_58(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_60(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 59)), TRLC_EXPAND_WITH_INDEX_59(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_61(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 60)), TRLC_EXPAND_WITH_INDEX_60(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_62(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 61)), TRLC_EXPAND_WITH_INDEX_61(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_63(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 62)), TRLC_EXPAND_WITH_INDEX_62(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_64(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 63)), TRLC_EXPAND_WITH_INDEX_63(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_65(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 64)), TRLC_EXPAND_WITH_INDEX_64(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_66(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 65)), TRLC_EXPAND_WITH_INDEX_65(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_67(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 66)), TRLC_EXPAND_WITH_INDEX_66(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_68(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 67)), TRLC_EXPAND_WITH_INDEX_67(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_69(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 68)), TRLC_EXPAND_WITH_INDEX_68(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_70(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 69)), TRLC_EXPAND_WITH_INDEX_69(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_71(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 70)), TRLC_EXPAND_WITH_INDEX_70(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_72(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 71)), TRLC_EXPAND_WITH_INDEX_71(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_73(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 72)), TRLC_EXPAND_WITH_INDEX_72(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_74(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 73)), TRLC_EXPAND_WITH_INDEX_73(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_75(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 74)), TRLC_EXPAND_WITH_INDEX_74(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_76(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 75)), TRLC_EXPAND_WITH_INDEX_75(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_77(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 76)), TRLC_EXPAND_WITH_INDEX_76(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_78(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 77)), TRLC_EXPAND_WITH_INDEX_77(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_79(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 78)), TRLC_EXPAND_WITH_INDEX_78(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_80(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 79)), TRLC_EXPAND_WITH_INDEX_79(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_81(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 80)), TRLC_EXPAND_WITH_INDEX_80(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_82(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 81)), TRLC_EXPAND_WITH_INDEX_81(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_83(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 82)), TRLC_EXPAND_WITH_INDEX_82(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_84(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 83)), TRLC_EXPAND_WITH_INDEX_83(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_85(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 84)), TRLC_EXPAND_WITH_INDEX_84(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_86(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 85)), TRLC_EXPAND_WITH_INDEX_85(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_87(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 86)), TRLC_EXPAND_WITH_INDEX_86(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_88(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 87)), TRLC_EXPAND_WITH_INDEX_87(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_89(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 88)), TRLC_EXPAND_WITH_INDEX_88(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_90(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 89)), TRLC_EXPAND_WITH_INDEX_89(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_91(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 90)), TRLC_EXPAND_WITH_INDEX_90(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_92(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 91)), TRLC_EXPAND_WITH_INDEX_91(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_93(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 92)), TRLC_EXPAND_WITH_INDEX_92(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_94(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 93)), TRLC_EXPAND_WITH_INDEX_93(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_95(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 94)), TRLC_EXPAND_WITH_INDEX_94(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_96(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 95)), TRLC_EXPAND_WITH_INDEX_95(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_97(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 96)), TRLC_EXPAND_WITH_INDEX_96(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_98(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 97)), TRLC_EXPAND_WITH_INDEX_97(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_99(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 98)), TRLC_EXPAND_WITH_INDEX_98(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_100(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 99)), TRLC_EXPAND_WITH_INDEX_99(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_101(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 100)), TRLC_EXPAND_WITH_INDEX_100(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_102(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 101)), TRLC_EXPAND_WITH_INDEX_101(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_103(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 102)), TRLC_EXPAND_WITH_INDEX_102(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_104(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 103)), TRLC_EXPAND_WITH_INDEX_103(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_105(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 104)), TRLC_EXPAND_WITH_INDEX_104(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_106(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 105)), TRLC_EXPAND_WITH_INDEX_105(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_107(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 106)), TRLC_EXPAND_WITH_INDEX_106(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_108(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 107)), TRLC_EXPAND_WITH_INDEX_107(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_109(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 108)), TRLC_EXPAND_WITH_INDEX_108(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_110(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 109)), TRLC_EXPAND_WITH_INDEX_109(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_111(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 110)), TRLC_EXPAND_WITH_INDEX_110(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_112(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 111)), TRLC_EXPAND_WITH_INDEX_111(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_113(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 112)), TRLC_EXPAND_WITH_INDEX_112(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_114(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 113)), TRLC_EXPAND_WITH_INDEX_113(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_115(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 114)), TRLC_EXPAND_WITH_INDEX_114(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_116(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 115)), TRLC_EXPAND_WITH_INDEX_115(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_117(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 116)), TRLC_EXPAND_WITH_INDEX_116(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_118(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 117)), TRLC_EXPAND_WITH_INDEX_117(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_119(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 118)), TRLC_EXPAND_WITH_INDEX_118(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_120(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 119)), TRLC_EXPAND_WITH_INDEX_119(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_121(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 120)), TRLC_EXPAND_WITH_INDEX_120(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_122(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 121)), TRLC_EXPAND_WITH_INDEX_121(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_123(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 122)), TRLC_EXPAND_WITH_INDEX_122(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_124(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 123)), TRLC_EXPAND_WITH_INDEX_123(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_125(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 124)), TRLC_EXPAND_WITH_INDEX_124(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_126(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 125)), TRLC_EXPAND_WITH_INDEX_125(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_127(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 126)), TRLC_EXPAND_WITH_INDEX_126(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_128(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 127)), TRLC_EXPAND_WITH_INDEX_127(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_129(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 128)), TRLC_EXPAND_WITH_INDEX_128(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_130(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 129)), TRLC_EXPAND_WITH_INDEX_129(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_131(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 130)), TRLC_EXPAND_WITH_INDEX_130(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_132(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 131)), TRLC_EXPAND_WITH_INDEX_131(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_133(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 132)), TRLC_EXPAND_WITH_INDEX_132(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_134(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 133)), TRLC_EXPAND_WITH_INDEX_133(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_135(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 134)), TRLC_EXPAND_WITH_INDEX_134(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_136(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 135)), TRLC_EXPAND_WITH_INDEX_135(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_137(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 136)), TRLC_EXPAND_WITH_INDEX_136(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_138(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 137)), TRLC_EXPAND_WITH_INDEX_137(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_139(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 138)), TRLC_EXPAND_WITH_INDEX_138(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_140(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 139)), TRLC_EXPAND_WITH_INDEX_139(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_141(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 140)), TRLC_EXPAND_WITH_INDEX_140(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_142(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 141)), TRLC_EXPAND_WITH_INDEX_141(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_143(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 142)), TRLC_EXPAND_WITH_INDEX_142(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_144(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 143)), TRLC_EXPAND_WITH_INDEX_143(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_145(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 144)), TRLC_EXPAND_WITH_INDEX_144(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_146(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 145)), TRLC_EXPAND_WITH_INDEX_145(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_147(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 146)), TRLC_EXPAND_WITH_INDEX_146(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_148(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 147)), TRLC_EXPAND_WITH_INDEX_147(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_149(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 148)), TRLC_EXPAND_WITH_INDEX_148(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_150(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 149)), TRLC_EXPAND_WITH_INDEX_149(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_151(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 150)), TRLC_EXPAND_WITH_INDEX_150(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_152(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 151)), TRLC_EXPAND_WITH_INDEX_151(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_153(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 152)), TRLC_EXPAND_WITH_INDEX_152(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_154(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 153)), TRLC_EXPAND_WITH_INDEX_153(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_155(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 154)), TRLC_EXPAND_WITH_INDEX_154(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_156(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 155)), TRLC_EXPAND_WITH_INDEX_155(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_157(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 156)), TRLC_EXPAND_WITH_INDEX_156(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_158(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 157)), TRLC_EXPAND_WITH_INDEX_157(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_159(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 158)), TRLC_EXPAND_WITH_INDEX_158(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_160(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 159)), TRLC_EXPAND_WITH_INDEX_159(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_161(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 160)), TRLC_EXPAND_WITH_INDEX_160(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_162(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 161)), TRLC_EXPAND_WITH_INDEX_161(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_163(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 162)), TRLC_EXPAND_WITH_INDEX_162(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_164(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 163)), TRLC_EXPAND_WITH_INDEX_163(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_165(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 164)), TRLC_EXPAND_WITH_INDEX_164(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_166(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 165)), TRLC_EXPAND_WITH_INDEX_165(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_167(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 166)), TRLC_EXPAND_WITH_INDEX_166(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_168(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 167)), TRLC_EXPAND_WITH_INDEX_167(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_169(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 168)), TRLC_EXPAND_WITH_INDEX_168(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_170(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 169)), TRLC_EXPAND_WITH_INDEX_169(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_171(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 170)), TRLC_EXPAND_WITH_INDEX_170(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_172(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 171)), TRLC_EXPAND_WITH_INDEX_171(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_173(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 172)), TRLC_EXPAND_WITH_INDEX_172(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_174(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 173)), TRLC_EXPAND_WITH_INDEX_173(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_175(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 174)), TRLC_EXPAND_WITH_INDEX_174(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_176(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 175)), TRLC_EXPAND_WITH_INDEX_175(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_177(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 176)), TRLC_EXPAND_WITH_INDEX_176(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_178(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 177)), TRLC_EXPAND_WITH_INDEX_177(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_179(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 178)), TRLC_EXPAND_WITH_INDEX_178(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_180(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 179)), TRLC_EXPAND_WITH_INDEX_179(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_181(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 180)), TRLC_EXPAND_WITH_INDEX_180(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_182(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 181)), TRLC_EXPAND_WITH_INDEX_181(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_183(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 182)), TRLC_EXPAND_WITH_INDEX_182(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_184(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 183)), TRLC_EXPAND_WITH_INDEX_183(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_185(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 184)), TRLC_EXPAND_WITH_INDEX_184(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_186(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 185)), TRLC_EXPAND_WITH_INDEX_185(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_187(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 186)), TRLC_EXPAND_WITH_INDEX_186(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_188(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 187)), TRLC_EXPAND_WITH_INDEX_187(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_189(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 188)), TRLC_EXPAND_WITH_INDEX_188(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_190(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 189)), TRLC_EXPAND_WITH_INDEX_189(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_191(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 190)), TRLC_EXPAND_WITH_INDEX_190(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_192(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 191)), TRLC_EXPAND_WITH_INDEX_191(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_193(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 192)), TRLC_EXPAND_WITH_INDEX_192(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_194(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 193)), TRLC_EXPAND_WITH_INDEX_193(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_195(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 194)), TRLC_EXPAND_WITH_INDEX_194(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_196(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 195)), TRLC_EXPAND_WITH_INDEX_195(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_197(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 196)), TRLC_EXPAND_WITH_INDEX_196(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_198(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 197)), TRLC_EXPAND_WITH_INDEX_197(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_199(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 198)), TRLC_EXPAND_WITH_INDEX_198(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_200(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 199)), TRLC_EXPAND_WITH_INDEX_199(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_201(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 200)), TRLC_EXPAND_WITH_INDEX_200(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_202(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 201)), TRLC_EXPAND_WITH_INDEX_201(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_203(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 202)), TRLC_EXPAND_WITH_INDEX_202(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_204(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 203)), TRLC_EXPAND_WITH_INDEX_203(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_205(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 204)), TRLC_EXPAND_WITH_INDEX_204(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_206(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 205)), TRLC_EXPAND_WITH_INDEX_205(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_207(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 206)), TRLC_EXPAND_WITH_INDEX_206(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_208(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 207)), TRLC_EXPAND_WITH_INDEX_207(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_209(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 208)), TRLC_EXPAND_WITH_INDEX_208(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_210(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 209)), TRLC_EXPAND_WITH_INDEX_209(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_211(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 210)), TRLC_EXPAND_WITH_INDEX_210(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_212(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 211)), TRLC_EXPAND_WITH_INDEX_211(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_213(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 212)), TRLC_EXPAND_WITH_INDEX_212(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_214(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 213)), TRLC_EXPAND_WITH_INDEX_213(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_215(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 214)), TRLC_EXPAND_WITH_INDEX_214(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_216(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 215)), TRLC_EXPAND_WITH_INDEX_215(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_217(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 216)), TRLC_EXPAND_WITH_INDEX_216(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_218(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 217)), TRLC_EXPAND_WITH_INDEX_217(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_219(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 218)), TRLC_EXPAND_WITH_INDEX_218(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_220(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 219)), TRLC_EXPAND_WITH_INDEX_219(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_221(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 220)), TRLC_EXPAND_WITH_INDEX_220(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_222(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 221)), TRLC_EXPAND_WITH_INDEX_221(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_223(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 222)), TRLC_EXPAND_WITH_INDEX_222(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_224(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 223)), TRLC_EXPAND_WITH_INDEX_223(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_225(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 224)), TRLC_EXPAND_WITH_INDEX_224(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_226(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 225)), TRLC_EXPAND_WITH_INDEX_225(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_227(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 226)), TRLC_EXPAND_WITH_INDEX_226(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_228(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 227)), TRLC_EXPAND_WITH_INDEX_227(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_229(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 228)), TRLC_EXPAND_WITH_INDEX_228(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_230(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 229)), TRLC_EXPAND_WITH_INDEX_229(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_231(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 230)), TRLC_EXPAND_WITH_INDEX_230(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_232(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 231)), TRLC_EXPAND_WITH_INDEX_231(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_233(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 232)), TRLC_EXPAND_WITH_INDEX_232(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_234(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 233)), TRLC_EXPAND_WITH_INDEX_233(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_235(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 234)), TRLC_EXPAND_WITH_INDEX_234(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_236(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 235)), TRLC_EXPAND_WITH_INDEX_235(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_237(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 236)), TRLC_EXPAND_WITH_INDEX_236(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_238(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 237)), TRLC_EXPAND_WITH_INDEX_237(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_239(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 238)), TRLC_EXPAND_WITH_INDEX_238(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_240(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 239)), TRLC_EXPAND_WITH_INDEX_239(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_241(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 240)), TRLC_EXPAND_WITH_INDEX_240(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_242(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 241)), TRLC_EXPAND_WITH_INDEX_241(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_243(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 242)), TRLC_EXPAND_WITH_INDEX_242(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_244(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 243)), TRLC_EXPAND_WITH_INDEX_243(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_245(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 244)), TRLC_EXPAND_WITH_INDEX_244(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_246(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 245)), TRLC_EXPAND_WITH_INDEX_245(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_247(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 246)), TRLC_EXPAND_WITH_INDEX_246(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_248(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 247)), TRLC_EXPAND_WITH_INDEX_247(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_249(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 248)), TRLC_EXPAND_WITH_INDEX_248(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_250(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 249)), TRLC_EXPAND_WITH_INDEX_249(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_251(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 250)), TRLC_EXPAND_WITH_INDEX_250(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_252(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 251)), TRLC_EXPAND_WITH_INDEX_251(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_253(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 252)), TRLC_EXPAND_WITH_INDEX_252(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_254(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 253)), TRLC_EXPAND_WITH_INDEX_253(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_255(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 254)), TRLC_EXPAND_WITH_INDEX_254(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_256(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 255)), TRLC_EXPAND_WITH_INDEX_255(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_257(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 256)), TRLC_EXPAND_WITH_INDEX_256(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_258(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 257)), TRLC_EXPAND_WITH_INDEX_257(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_259(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 258)), TRLC_EXPAND_WITH_INDEX_258(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_260(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 259)), TRLC_EXPAND_WITH_INDEX_259(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_261(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 260)), TRLC_EXPAND_WITH_INDEX_260(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_262(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 261)), TRLC_EXPAND_WITH_INDEX_261(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_263(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 262)), TRLC_EXPAND_WITH_INDEX_262(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_264(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 263)), TRLC_EXPAND_WITH_INDEX_263(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_265(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 264)), TRLC_EXPAND_WITH_INDEX_264(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_266(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 265)), TRLC_EXPAND_WITH_INDEX_265(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_267(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 266)), TRLC_EXPAND_WITH_INDEX_266(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_268(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 267)), TRLC_EXPAND_WITH_INDEX_267(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_269(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 268)), TRLC_EXPAND_WITH_INDEX_268(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_270(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 269)), TRLC_EXPAND_WITH_INDEX_269(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_271(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 270)), TRLC_EXPAND_WITH_INDEX_270(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_272(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 271)), TRLC_EXPAND_WITH_INDEX_271(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_273(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 272)), TRLC_EXPAND_WITH_INDEX_272(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_274(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 273)), TRLC_EXPAND_WITH_INDEX_273(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_275(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 274)), TRLC_EXPAND_WITH_INDEX_274(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_276(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 275)), TRLC_EXPAND_WITH_INDEX_275(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_277(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 276)), TRLC_EXPAND_WITH_INDEX_276(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_278(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 277)), TRLC_EXPAND_WITH_INDEX_277(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_279(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 278)), TRLC_EXPAND_WITH_INDEX_278(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_280(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 279)), TRLC_EXPAND_WITH_INDEX_279(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_281(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 280)), TRLC_EXPAND_WITH_INDEX_280(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_282(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 281)), TRLC_EXPAND_WITH_INDEX_281(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_283(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 282)), TRLC_EXPAND_WITH_INDEX_282(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_284(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 283)), TRLC_EXPAND_WITH_INDEX_283(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_285(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 284)), TRLC_EXPAND_WITH_INDEX_284(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_286(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 285)), TRLC_EXPAND_WITH_INDEX_285(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_287(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 286)), TRLC_EXPAND_WITH_INDEX_286(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_288(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 287)), TRLC_EXPAND_WITH_INDEX_287(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_289(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 288)), TRLC_EXPAND_WITH_INDEX_288(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_290(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 289)), TRLC_EXPAND_WITH_INDEX_289(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_291(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 290)), TRLC_EXPAND_WITH_INDEX_290(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_292(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 291)), TRLC_EXPAND_WITH_INDEX_291(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_293(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 292)), TRLC_EXPAND_WITH_INDEX_292(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_294(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 293)), TRLC_EXPAND_WITH_INDEX_293(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_295(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 294)), TRLC_EXPAND_WITH_INDEX_294(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_296(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 295)), TRLC_EXPAND_WITH_INDEX_295(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_297(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 296)), TRLC_EXPAND_WITH_INDEX_296(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_298(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 297)), TRLC_EXPAND_WITH_INDEX_297(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_299(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 298)), TRLC_EXPAND_WITH_INDEX_298(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_300(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 299)), TRLC_EXPAND_WITH_INDEX_299(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_301(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 300)), TRLC_EXPAND_WITH_INDEX_300(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_302(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 301)), TRLC_EXPAND_WITH_INDEX_301(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_303(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 302)), TRLC_EXPAND_WITH_INDEX_302(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_304(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 303)), TRLC_EXPAND_WITH_INDEX_303(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_305(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 304)), TRLC_EXPAND_WITH_INDEX_304(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_306(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 305)), TRLC_EXPAND_WITH_INDEX_305(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_307(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 306)), TRLC_EXPAND_WITH_INDEX_306(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_308(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 307)), TRLC_EXPAND_WITH_INDEX_307(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_309(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 308)), TRLC_EXPAND_WITH_INDEX_308(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_310(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 309)), TRLC_EXPAND_WITH_INDEX_309(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_311(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 310)), TRLC_EXPAND_WITH_INDEX_310(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_312(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 311)), TRLC_EXPAND_WITH_INDEX_311(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_313(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 312)), TRLC_EXPAND_WITH_INDEX_312(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_314(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 313)), TRLC_EXPAND_WITH_INDEX_313(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_315(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 314)), TRLC_EXPAND_WITH_INDEX_314(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_316(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 315)), TRLC_EXPAND_WITH_INDEX_315(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_317(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 316)), TRLC_EXPAND_WITH_INDEX_316(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_318(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 317)), TRLC_EXPAND_WITH_INDEX_317(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_319(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 318)), TRLC_EXPAND_WITH_INDEX_318(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_320(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 319)), TRLC_EXPAND_WITH_INDEX_319(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_321(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 320)), TRLC_EXPAND_WITH_INDEX_320(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_322(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 321)), TRLC_EXPAND_WITH_INDEX_321(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_323(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 322)), TRLC_EXPAND_WITH_INDEX_322(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_324(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 323)), TRLC_EXPAND_WITH_INDEX_323(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_325(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 324)), TRLC_EXPAND_WITH_INDEX_324(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_326(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 325)), TRLC_EXPAND_WITH_INDEX_325(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_327(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 326)), TRLC_EXPAND_WITH_INDEX_326(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_328(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 327)), TRLC_EXPAND_WITH_INDEX_327(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_329(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 328)), TRLC_EXPAND_WITH_INDEX_328(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_330(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 329)), TRLC_EXPAND_WITH_INDEX_329(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_331(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 330)), TRLC_EXPAND_WITH_INDEX_330(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_332(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 331)), TRLC_EXPAND_WITH_INDEX_331(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_333(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 332)), TRLC_EXPAND_WITH_INDEX_332(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_334(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 333)), TRLC_EXPAND_WITH_INDEX_333(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_335(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 334)), TRLC_EXPAND_WITH_INDEX_334(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_336(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 335)), TRLC_EXPAND_WITH_INDEX_335(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_337(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 336)), TRLC_EXPAND_WITH_INDEX_336(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_338(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 337)), TRLC_EXPAND_WITH_INDEX_337(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_339(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 338)), TRLC_EXPAND_WITH_INDEX_338(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_340(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 339)), TRLC_EXPAND_WITH_INDEX_339(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_341(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 340)), TRLC_EXPAND_WITH_INDEX_340(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_342(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 341)), TRLC_EXPAND_WITH_INDEX_341(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_343(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 342)), TRLC_EXPAND_WITH_INDEX_342(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_344(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 343)), TRLC_EXPAND_WITH_INDEX_343(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_345(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 344)), TRLC_EXPAND_WITH_INDEX_344(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_346(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 345)), TRLC_EXPAND_WITH_INDEX_345(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_347(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 346)), TRLC_EXPAND_WITH_INDEX_346(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_348(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 347)), TRLC_EXPAND_WITH_INDEX_347(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_349(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 348)), TRLC_EXPAND_WITH_INDEX_348(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_350(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 349)), TRLC_EXPAND_WITH_INDEX_349(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_351(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 350)), TRLC_EXPAND_WITH_INDEX_350(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_352(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 351)), TRLC_EXPAND_WITH_INDEX_351(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_353(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 352)), TRLC_EXPAND_WITH_INDEX_352(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_354(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 353)), TRLC_EXPAND_WITH_INDEX_353(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_355(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 354)), TRLC_EXPAND_WITH_INDEX_354(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_356(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 355)), TRLC_EXPAND_WITH_INDEX_355(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_357(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 356)), TRLC_EXPAND_WITH_INDEX_356(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_358(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 357)), TRLC_EXPAND_WITH_INDEX_357(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_359(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 358)), TRLC_EXPAND_WITH_INDEX_358(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_360(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 359)), TRLC_EXPAND_WITH_INDEX_359(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_361(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 360)), TRLC_EXPAND_WITH_INDEX_360(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_362(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 361)), TRLC_EXPAND_WITH_INDEX_361(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_363(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 362)), TRLC_EXPAND_WITH_INDEX_362(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_364(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 363)), TRLC_EXPAND_WITH_INDEX_363(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_365(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 364)), TRLC_EXPAND_WITH_INDEX_364(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_366(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 365)), TRLC_EXPAND_WITH_INDEX_365(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_367(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 366)), TRLC_EXPAND_WITH_INDEX_366(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_368(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 367)), TRLC_EXPAND_WITH_INDEX_367(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_369(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 368)), TRLC_EXPAND_WITH_INDEX_368(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_370(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 369)), TRLC_EXPAND_WITH_INDEX_369(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_371(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 370)), TRLC_EXPAND_WITH_INDEX_370(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_372(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 371)), TRLC_EXPAND_WITH_INDEX_371(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_373(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 372)), TRLC_EXPAND_WITH_INDEX_372(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_374(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 373)), TRLC_EXPAND_WITH_INDEX_373(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_375(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 374)), TRLC_EXPAND_WITH_INDEX_374(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_376(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 375)), TRLC_EXPAND_WITH_INDEX_375(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_377(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 376)), TRLC_EXPAND_WITH_INDEX_376(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_378(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 377)), TRLC_EXPAND_WITH_INDEX_377(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_379(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 378)), TRLC_EXPAND_WITH_INDEX_378(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_380(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 379)), TRLC_EXPAND_WITH_INDEX_379(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_381(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 380)), TRLC_EXPAND_WITH_INDEX_380(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_382(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 381)), TRLC_EXPAND_WITH_INDEX_381(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_383(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 382)), TRLC_EXPAND_WITH_INDEX_382(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_384(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 383)), TRLC_EXPAND_WITH_INDEX_383(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_385(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 384)), TRLC_EXPAND_WITH_INDEX_384(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_386(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 385)), TRLC_EXPAND_WITH_INDEX_385(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_387(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 386)), TRLC_EXPAND_WITH_INDEX_386(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_388(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 387)), TRLC_EXPAND_WITH_INDEX_387(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_389(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 388)), TRLC_EXPAND_WITH_INDEX_388(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_390(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 389)), TRLC_EXPAND_WITH_INDEX_389(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_391(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 390)), TRLC_EXPAND_WITH_INDEX_390(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_392(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 391)), TRLC_EXPAND_WITH_INDEX_391(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_393(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 392)), TRLC_EXPAND_WITH_INDEX_392(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_394(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 393)), TRLC_EXPAND_WITH_INDEX_393(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_395(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 394)), TRLC_EXPAND_WITH_INDEX_394(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_396(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 395)), TRLC_EXPAND_WITH_INDEX_395(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_397(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 396)), TRLC_EXPAND_WITH_INDEX_396(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_398(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 397)), TRLC_EXPAND_WITH_INDEX_397(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_399(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 398)), TRLC_EXPAND_WITH_INDEX_398(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_400(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 399)), TRLC_EXPAND_WITH_INDEX_399(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_401(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 400)), TRLC_EXPAND_WITH_INDEX_400(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_402(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 401)), TRLC_EXPAND_WITH_INDEX_401(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_403(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 402)), TRLC_EXPAND_WITH_INDEX_402(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_404(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 403)), TRLC_EXPAND_WITH_INDEX_403(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_405(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 404)), TRLC_EXPAND_WITH_INDEX_404(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_406(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 405)), TRLC_EXPAND_WITH_INDEX_405(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_407(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 406)), TRLC_EXPAND_WITH_INDEX_406(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_408(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 407)), TRLC_EXPAND_WITH_INDEX_407(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_409(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 408)), TRLC_EXPAND_WITH_INDEX_408(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_410(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 409)), TRLC_EXPAND_WITH_INDEX_409(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_411(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 410)), TRLC_EXPAND_WITH_INDEX_410(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_412(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 411)), TRLC_EXPAND_WITH_INDEX_411(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_413(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 412)), TRLC_EXPAND_WITH_INDEX_412(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_414(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 413)), TRLC_EXPAND_WITH_INDEX_413(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_415(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 414)), TRLC_EXPAND_WITH_INDEX_414(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_416(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 415)), TRLC_EXPAND_WITH_INDEX_415(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_417(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 416)), TRLC_EXPAND_WITH_INDEX_416(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_418(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 417)), TRLC_EXPAND_WITH_INDEX_417(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_419(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 418)), TRLC_EXPAND_WITH_INDEX_418(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_420(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 419)), TRLC_EXPAND_WITH_INDEX_419(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_421(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 420)), TRLC_EXPAND_WITH_INDEX_420(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_422(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 421)), TRLC_EXPAND_WITH_INDEX_421(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_423(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 422)), TRLC_EXPAND_WITH_INDEX_422(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_424(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 423)), TRLC_EXPAND_WITH_INDEX_423(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_425(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 424)), TRLC_EXPAND_WITH_INDEX_424(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_426(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 425)), TRLC_EXPAND_WITH_INDEX_425(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_427(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 426)), TRLC_EXPAND_WITH_INDEX_426(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_428(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 427)), TRLC_EXPAND_WITH_INDEX_427(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_429(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 428)), TRLC_EXPAND_WITH_INDEX_428(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_430(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 429)), TRLC_EXPAND_WITH_INDEX_429(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_431(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 430)), TRLC_EXPAND_WITH_INDEX_430(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_432(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 431)), TRLC_EXPAND_WITH_INDEX_431(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_433(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 432)), TRLC_EXPAND_WITH_INDEX_432(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_434(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 433)), TRLC_EXPAND_WITH_INDEX_433(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_435(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 434)), TRLC_EXPAND_WITH_INDEX_434(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_436(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 435)), TRLC_EXPAND_WITH_INDEX_435(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_437(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 436)), TRLC_EXPAND_WITH_INDEX_436(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_438(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 437)), TRLC_EXPAND_WITH_INDEX_437(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_439(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 438)), TRLC_EXPAND_WITH_INDEX_438(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_440(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 439)), TRLC_EXPAND_WITH_INDEX_439(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_441(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 440)), TRLC_EXPAND_WITH_INDEX_440(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_442(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 441)), TRLC_EXPAND_WITH_INDEX_441(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_443(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 442)), TRLC_EXPAND_WITH_INDEX_442(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_444(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 443)), TRLC_EXPAND_WITH_INDEX_443(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_445(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 444)), TRLC_EXPAND_WITH_INDEX_444(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_446(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 445)), TRLC_EXPAND_WITH_INDEX_445(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_447(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 446)), TRLC_EXPAND_WITH_INDEX_446(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_448(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 447)), TRLC_EXPAND_WITH_INDEX_447(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_449(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 448)), TRLC_EXPAND_WITH_INDEX_448(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_450(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 449)), TRLC_EXPAND_WITH_INDEX_449(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_451(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 450)), TRLC_EXPAND_WITH_INDEX_450(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_452(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 451)), TRLC_EXPAND_WITH_INDEX_451(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_453(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 452)), TRLC_EXPAND_WITH_INDEX_452(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_454(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 453)), TRLC_EXPAND_WITH_INDEX_453(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_455(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 454)), TRLC_EXPAND_WITH_INDEX_454(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_456(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 455)), TRLC_EXPAND_WITH_INDEX_455(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_457(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 456)), TRLC_EXPAND_WITH_INDEX_456(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_458(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 457)), TRLC_EXPAND_WITH_INDEX_457(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_459(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 458)), TRLC_EXPAND_WITH_INDEX_458(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_460(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 459)), TRLC_EXPAND_WITH_INDEX_459(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_461(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 460)), TRLC_EXPAND_WITH_INDEX_460(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_462(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 461)), TRLC_EXPAND_WITH_INDEX_461(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_463(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 462)), TRLC_EXPAND_WITH_INDEX_462(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_464(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 463)), TRLC_EXPAND_WITH_INDEX_463(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_465(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 464)), TRLC_EXPAND_WITH_INDEX_464(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_466(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 465)), TRLC_EXPAND_WITH_INDEX_465(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_467(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 466)), TRLC_EXPAND_WITH_INDEX_466(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_468(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 467)), TRLC_EXPAND_WITH_INDEX_467(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_469(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 468)), TRLC_EXPAND_WITH_INDEX_468(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_470(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 469)), TRLC_EXPAND_WITH_INDEX_469(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_471(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 470)), TRLC_EXPAND_WITH_INDEX_470(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_472(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 471)), TRLC_EXPAND_WITH_INDEX_471(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_473(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 472)), TRLC_EXPAND_WITH_INDEX_472(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_474(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 473)), TRLC_EXPAND_WITH_INDEX_473(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_475(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 474)), TRLC_EXPAND_WITH_INDEX_474(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_476(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 475)), TRLC_EXPAND_WITH_INDEX_475(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_477(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 476)), TRLC_EXPAND_WITH_INDEX_476(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_478(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 477)), TRLC_EXPAND_WITH_INDEX_477(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_479(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 478)), TRLC_EXPAND_WITH_INDEX_478(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_480(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 479)), TRLC_EXPAND_WITH_INDEX_479(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_481(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 480)), TRLC_EXPAND_WITH_INDEX_480(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_482(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 481)), TRLC_EXPAND_WITH_INDEX_481(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_483(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 482)), TRLC_EXPAND_WITH_INDEX_482(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_484(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 483)), TRLC_EXPAND_WITH_INDEX_483(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_485(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 484)), TRLC_EXPAND_WITH_INDEX_484(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_486(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 485)), TRLC_EXPAND_WITH_INDEX_485(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_487(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 486)), TRLC_EXPAND_WITH_INDEX_486(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_488(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 487)), TRLC_EXPAND_WITH_INDEX_487(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_489(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 488)), TRLC_EXPAND_WITH_INDEX_488(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_490(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 489)), TRLC_EXPAND_WITH_INDEX_489(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_491(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 490)), TRLC_EXPAND_WITH_INDEX_490(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_492(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 491)), TRLC_EXPAND_WITH_INDEX_491(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_493(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 492)), TRLC_EXPAND_WITH_INDEX_492(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_494(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 493)), TRLC_EXPAND_WITH_INDEX_493(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_495(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 494)), TRLC_EXPAND_WITH_INDEX_494(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_496(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 495)), TRLC_EXPAND_WITH_INDEX_495(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_497(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 496)), TRLC_EXPAND_WITH_INDEX_496(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_498(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 497)), TRLC_EXPAND_WITH_INDEX_497(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_499(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 498)), TRLC_EXPAND_WITH_INDEX_498(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_500(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 499)), TRLC_EXPAND_WITH_INDEX_499(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_501(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 500)), TRLC_EXPAND_WITH_INDEX_500(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_502(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 501)), TRLC_EXPAND_WITH_INDEX_501(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_503(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 502)), TRLC_EXPAND_WITH_INDEX_502(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_504(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 503)), TRLC_EXPAND_WITH_INDEX_503(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_505(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 504)), TRLC_EXPAND_WITH_INDEX_504(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_506(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 505)), TRLC_EXPAND_WITH_INDEX_505(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_507(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 506)), TRLC_EXPAND_WITH_INDEX_506(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_508(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 507)), TRLC_EXPAND_WITH_INDEX_507(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_509(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 508)), TRLC_EXPAND_WITH_INDEX_508(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_510(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 509)), TRLC_EXPAND_WITH_INDEX_509(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_511(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 510)), TRLC_EXPAND_WITH_INDEX_510(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_512(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 511)), TRLC_EXPAND_WITH_INDEX_511(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_513(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 512)), TRLC_EXPAND_WITH_INDEX_512(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_514(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 513)), TRLC_EXPAND_WITH_INDEX_513(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_515(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 514)), TRLC_EXPAND_WITH_INDEX_514(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_516(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 515)), TRLC_EXPAND_WITH_INDEX_515(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_517(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 516)), TRLC_EXPAND_WITH_INDEX_516(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_518(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 517)), TRLC_EXPAND_WITH_INDEX_517(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_519(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 518)), TRLC_EXPAND_WITH_INDEX_518(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_520(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 519)), TRLC_EXPAND_WITH_INDEX_519(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_521(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 520)), TRLC_EXPAND_WITH_INDEX_520(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_522(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 521)), TRLC_EXPAND_WITH_INDEX_521(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_523(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 522)), TRLC_EXPAND_WITH_INDEX_522(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_524(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 523)), TRLC_EXPAND_WITH_INDEX_523(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_525(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 524)), TRLC_EXPAND_WITH_INDEX_524(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_526(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 525)), TRLC_EXPAND_WITH_INDEX_525(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_527(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 526)), TRLC_EXPAND_WITH_INDEX_526(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_528(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 527)), TRLC_EXPAND_WITH_INDEX_527(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_529(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 528)), TRLC_EXPAND_WITH_INDEX_528(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_530(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 529)), TRLC_EXPAND_WITH_INDEX_529(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_531(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 530)), TRLC_EXPAND_WITH_INDEX_530(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_532(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 531)), TRLC_EXPAND_WITH_INDEX_531(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_533(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 532)), TRLC_EXPAND_WITH_INDEX_532(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_534(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 533)), TRLC_EXPAND_WITH_INDEX_533(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_535(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 534)), TRLC_EXPAND_WITH_INDEX_534(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_536(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 535)), TRLC_EXPAND_WITH_INDEX_535(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_537(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 536)), TRLC_EXPAND_WITH_INDEX_536(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_538(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 537)), TRLC_EXPAND_WITH_INDEX_537(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_539(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 538)), TRLC_EXPAND_WITH_INDEX_538(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_540(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 539)), TRLC_EXPAND_WITH_INDEX_539(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_541(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 540)), TRLC_EXPAND_WITH_INDEX_540(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_542(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 541)), TRLC_EXPAND_WITH_INDEX_541(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_543(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 542)), TRLC_EXPAND_WITH_INDEX_542(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_544(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 543)), TRLC_EXPAND_WITH_INDEX_543(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_545(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 544)), TRLC_EXPAND_WITH_INDEX_544(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_546(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 545)), TRLC_EXPAND_WITH_INDEX_545(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_547(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 546)), TRLC_EXPAND_WITH_INDEX_546(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_548(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 547)), TRLC_EXPAND_WITH_INDEX_547(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_549(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 548)), TRLC_EXPAND_WITH_INDEX_548(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_550(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 549)), TRLC_EXPAND_WITH_INDEX_549(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_551(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 550)), TRLC_EXPAND_WITH_INDEX_550(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_552(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 551)), TRLC_EXPAND_WITH_INDEX_551(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_553(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 552)), TRLC_EXPAND_WITH_INDEX_552(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_554(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 553)), TRLC_EXPAND_WITH_INDEX_553(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_555(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 554)), TRLC_EXPAND_WITH_INDEX_554(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_556(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 555)), TRLC_EXPAND_WITH_INDEX_555(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_557(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 556)), TRLC_EXPAND_WITH_INDEX_556(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_558(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 557)), TRLC_EXPAND_WITH_INDEX_557(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_559(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 558)), TRLC_EXPAND_WITH_INDEX_558(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_560(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 559)), TRLC_EXPAND_WITH_INDEX_559(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_561(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 560)), TRLC_EXPAND_WITH_INDEX_560(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_562(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 561)), TRLC_EXPAND_WITH_INDEX_561(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_563(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 562)), TRLC_EXPAND_WITH_INDEX_562(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_564(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 563)), TRLC_EXPAND_WITH_INDEX_563(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_565(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 564)), TRLC_EXPAND_WITH_INDEX_564(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_566(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 565)), TRLC_EXPAND_WITH_INDEX_565(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_567(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 566)), TRLC_EXPAND_WITH_INDEX_566(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_568(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 567)), TRLC_EXPAND_WITH_INDEX_567(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_569(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 568)), TRLC_EXPAND_WITH_INDEX_568(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_570(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 569)), TRLC_EXPAND_WITH_INDEX_569(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_571(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 570)), TRLC_EXPAND_WITH_INDEX_570(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_572(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 571)), TRLC_EXPAND_WITH_INDEX_571(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_573(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 572)), TRLC_EXPAND_WITH_INDEX_572(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_574(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 573)), TRLC_EXPAND_WITH_INDEX_573(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_575(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 574)), TRLC_EXPAND_WITH_INDEX_574(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_576(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 575)), TRLC_EXPAND_WITH_INDEX_575(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_577(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 576)), TRLC_EXPAND_WITH_INDEX_576(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_578(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 577)), TRLC_EXPAND_WITH_INDEX_577(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_579(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 578)), TRLC_EXPAND_WITH_INDEX_578(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_580(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 579)), TRLC_EXPAND_WITH_INDEX_579(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_581(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 580)), TRLC_EXPAND_WITH_INDEX_580(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_582(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 581)), TRLC_EXPAND_WITH_INDEX_581(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_583(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 582)), TRLC_EXPAND_WITH_INDEX_582(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_584(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 583)), TRLC_EXPAND_WITH_INDEX_583(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_585(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 584)), TRLC_EXPAND_WITH_INDEX_584(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_586(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 585)), TRLC_EXPAND_WITH_INDEX_585(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_587(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 586)), TRLC_EXPAND_WITH_INDEX_586(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_588(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 587)), TRLC_EXPAND_WITH_INDEX_587(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_589(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 588)), TRLC_EXPAND_WITH_INDEX_588(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_590(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 589)), TRLC_EXPAND_WITH_INDEX_589(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_591(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 590)), TRLC_EXPAND_WITH_INDEX_590(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_592(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 591)), TRLC_EXPAND_WITH_INDEX_591(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_593(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 592)), TRLC_EXPAND_WITH_INDEX_592(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_594(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 593)), TRLC_EXPAND_WITH_INDEX_593(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_595(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 594)), TRLC_EXPAND_WITH_INDEX_594(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_596(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 595)), TRLC_EXPAND_WITH_INDEX_595(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_597(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 596)), TRLC_EXPAND_WITH_INDEX_596(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_598(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 597)), TRLC_EXPAND_WITH_INDEX_597(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_599(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 598)), TRLC_EXPAND_WITH_INDEX_598(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_600(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 599)), TRLC_EXPAND_WITH_INDEX_599(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_601(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 600)), TRLC_EXPAND_WITH_INDEX_600(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_602(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 601)), TRLC_EXPAND_WITH_INDEX_601(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_603(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 602)), TRLC_EXPAND_WITH_INDEX_602(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_604(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 603)), TRLC_EXPAND_WITH_INDEX_603(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_605(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 604)), TRLC_EXPAND_WITH_INDEX_604(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_606(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 605)), TRLC_EXPAND_WITH_INDEX_605(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_607(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 606)), TRLC_EXPAND_WITH_INDEX_606(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_608(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 607)), TRLC_EXPAND_WITH_INDEX_607(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_609(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 608)), TRLC_EXPAND_WITH_INDEX_608(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_610(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 609)), TRLC_EXPAND_WITH_INDEX_609(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_611(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 610)), TRLC_EXPAND_WITH_INDEX_610(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_612(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 611)), TRLC_EXPAND_WITH_INDEX_611(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_613(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 612)), TRLC_EXPAND_WITH_INDEX_612(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_614(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 613)), TRLC_EXPAND_WITH_INDEX_613(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_615(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 614)), TRLC_EXPAND_WITH_INDEX_614(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_616(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 615)), TRLC_EXPAND_WITH_INDEX_615(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_617(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 616)), TRLC_EXPAND_WITH_INDEX_616(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_618(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 617)), TRLC_EXPAND_WITH_INDEX_617(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_619(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 618)), TRLC_EXPAND_WITH_INDEX_618(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_620(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 619)), TRLC_EXPAND_WITH_INDEX_619(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_621(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 620)), TRLC_EXPAND_WITH_INDEX_620(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_622(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 621)), TRLC_EXPAND_WITH_INDEX_621(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_623(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 622)), TRLC_EXPAND_WITH_INDEX_622(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_624(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 623)), TRLC_EXPAND_WITH_INDEX_623(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_625(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 624)), TRLC_EXPAND_WITH_INDEX_624(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_626(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 625)), TRLC_EXPAND_WITH_INDEX_625(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_627(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 626)), TRLC_EXPAND_WITH_INDEX_626(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_628(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 627)), TRLC_EXPAND_WITH_INDEX_627(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_629(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 628)), TRLC_EXPAND_WITH_INDEX_628(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_630(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 629)), TRLC_EXPAND_WITH_INDEX_629(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_631(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 630)), TRLC_EXPAND_WITH_INDEX_630(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_632(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 631)), TRLC_EXPAND_WITH_INDEX_631(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_633(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 632)), TRLC_EXPAND_WITH_INDEX_632(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_634(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 633)), TRLC_EXPAND_WITH_INDEX_633(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_635(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 634)), TRLC_EXPAND_WITH_INDEX_634(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_636(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 635)), TRLC_EXPAND_WITH_INDEX_635(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_637(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 636)), TRLC_EXPAND_WITH_INDEX_636(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_638(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 637)), TRLC_EXPAND_WITH_INDEX_637(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_639(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 638)), TRLC_EXPAND_WITH_INDEX_638(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_640(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 639)), TRLC_EXPAND_WITH_INDEX_639(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_641(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 640)), TRLC_EXPAND_WITH_INDEX_640(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_642(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 641)), TRLC_EXPAND_WITH_INDEX_641(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_643(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 642)), TRLC_EXPAND_WITH_INDEX_642(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_644(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 643)), TRLC_EXPAND_WITH_INDEX_643(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_645(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 644)), TRLC_EXPAND_WITH_INDEX_644(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_646(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 645)), TRLC_EXPAND_WITH_INDEX_645(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_647(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 646)), TRLC_EXPAND_WITH_INDEX_646(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_648(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 647)), TRLC_EXPAND_WITH_INDEX_647(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_649(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 648)), TRLC_EXPAND_WITH_INDEX_648(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_650(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 649)), TRLC_EXPAND_WITH_INDEX_649(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_651(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 650)), TRLC_EXPAND_WITH_INDEX_650(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_652(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 651)), TRLC_EXPAND_WITH_INDEX_651(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_653(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 652)), TRLC_EXPAND_WITH_INDEX_652(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_654(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 653)), TRLC_EXPAND_WITH_INDEX_653(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_655(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 654)), TRLC_EXPAND_WITH_INDEX_654(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_656(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 655)), TRLC_EXPAND_WITH_INDEX_655(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_657(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 656)), TRLC_EXPAND_WITH_INDEX_656(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_658(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 657)), TRLC_EXPAND_WITH_INDEX_657(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_659(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 658)), TRLC_EXPAND_WITH_INDEX_658(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_660(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 659)), TRLC_EXPAND_WITH_INDEX_659(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_661(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 660)), TRLC_EXPAND_WITH_INDEX_660(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_662(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 661)), TRLC_EXPAND_WITH_INDEX_661(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_663(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 662)), TRLC_EXPAND_WITH_INDEX_662(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_664(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 663)), TRLC_EXPAND_WITH_INDEX_663(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_665(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 664)), TRLC_EXPAND_WITH_INDEX_664(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_666(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 665)), TRLC_EXPAND_WITH_INDEX_665(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_667(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 666)), TRLC_EXPAND_WITH_INDEX_666(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_668(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 667)), TRLC_EXPAND_WITH_INDEX_667(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_669(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 668)), TRLC_EXPAND_WITH_INDEX_668(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_670(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 669)), TRLC_EXPAND_WITH_INDEX_669(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_671(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 670)), TRLC_EXPAND_WITH_INDEX_670(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_672(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 671)), TRLC_EXPAND_WITH_INDEX_671(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_673(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 672)), TRLC_EXPAND_WITH_INDEX_672(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_674(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 673)), TRLC_EXPAND_WITH_INDEX_673(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_675(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 674)), TRLC_EXPAND_WITH_INDEX_674(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_676(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 675)), TRLC_EXPAND_WITH_INDEX_675(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_677(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 676)), TRLC_EXPAND_WITH_INDEX_676(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_678(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 677)), TRLC_EXPAND_WITH_INDEX_677(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_679(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 678)), TRLC_EXPAND_WITH_INDEX_678(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_680(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 679)), TRLC_EXPAND_WITH_INDEX_679(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_681(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 680)), TRLC_EXPAND_WITH_INDEX_680(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_682(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 681)), TRLC_EXPAND_WITH_INDEX_681(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_683(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 682)), TRLC_EXPAND_WITH_INDEX_682(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_684(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 683)), TRLC_EXPAND_WITH_INDEX_683(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_685(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 684)), TRLC_EXPAND_WITH_INDEX_684(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_686(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 685)), TRLC_EXPAND_WITH_INDEX_685(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_687(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 686)), TRLC_EXPAND_WITH_INDEX_686(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_688(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 687)), TRLC_EXPAND_WITH_INDEX_687(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_689(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 688)), TRLC_EXPAND_WITH_INDEX_688(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_690(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 689)), TRLC_EXPAND_WITH_INDEX_689(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_691(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 690)), TRLC_EXPAND_WITH_INDEX_690(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_692(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 691)), TRLC_EXPAND_WITH_INDEX_691(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_693(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 692)), TRLC_EXPAND_WITH_INDEX_692(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_694(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 693)), TRLC_EXPAND_WITH_INDEX_693(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_695(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 694)), TRLC_EXPAND_WITH_INDEX_694(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_696(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 695)), TRLC_EXPAND_WITH_INDEX_695(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_697(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 696)), TRLC_EXPAND_WITH_INDEX_696(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_698(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 697)), TRLC_EXPAND_WITH_INDEX_697(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_699(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 698)), TRLC_EXPAND_WITH_INDEX_698(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_700(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 699)), TRLC_EXPAND_WITH_INDEX_699(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_701(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 700)), TRLC_EXPAND_WITH_INDEX_700(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_702(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 701)), TRLC_EXPAND_WITH_INDEX_701(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_703(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 702)), TRLC_EXPAND_WITH_INDEX_702(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_704(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 703)), TRLC_EXPAND_WITH_INDEX_703(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_705(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 704)), TRLC_EXPAND_WITH_INDEX_704(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_706(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 705)), TRLC_EXPAND_WITH_INDEX_705(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_707(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 706)), TRLC_EXPAND_WITH_INDEX_706(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_708(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 707)), TRLC_EXPAND_WITH_INDEX_707(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_709(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 708)), TRLC_EXPAND_WITH_INDEX_708(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_710(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 709)), TRLC_EXPAND_WITH_INDEX_709(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_711(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 710)), TRLC_EXPAND_WITH_INDEX_710(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_712(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 711)), TRLC_EXPAND_WITH_INDEX_711(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_713(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 712)), TRLC_EXPAND_WITH_INDEX_712(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_714(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 713)), TRLC_EXPAND_WITH_INDEX_713(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_715(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 714)), TRLC_EXPAND_WITH_INDEX_714(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_716(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 715)), TRLC_EXPAND_WITH_INDEX_715(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_717(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 716)), TRLC_EXPAND_WITH_INDEX_716(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_718(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 717)), TRLC_EXPAND_WITH_INDEX_717(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_719(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 718)), TRLC_EXPAND_WITH_INDEX_718(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_720(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 719)), TRLC_EXPAND_WITH_INDEX_719(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_721(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 720)), TRLC_EXPAND_WITH_INDEX_720(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_722(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 721)), TRLC_EXPAND_WITH_INDEX_721(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_723(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 722)), TRLC_EXPAND_WITH_INDEX_722(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_724(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 723)), TRLC_EXPAND_WITH_INDEX_723(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_725(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 724)), TRLC_EXPAND_WITH_INDEX_724(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_726(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 725)), TRLC_EXPAND_WITH_INDEX_725(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_727(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 726)), TRLC_EXPAND_WITH_INDEX_726(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_728(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 727)), TRLC_EXPAND_WITH_INDEX_727(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_729(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 728)), TRLC_EXPAND_WITH_INDEX_728(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_730(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 729)), TRLC_EXPAND_WITH_INDEX_729(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_731(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 730)), TRLC_EXPAND_WITH_INDEX_730(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_732(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 731)), TRLC_EXPAND_WITH_INDEX_731(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_733(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 732)), TRLC_EXPAND_WITH_INDEX_732(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_734(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 733)), TRLC_EXPAND_WITH_INDEX_733(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_735(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 734)), TRLC_EXPAND_WITH_INDEX_734(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_736(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 735)), TRLC_EXPAND_WITH_INDEX_735(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_737(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 736)), TRLC_EXPAND_WITH_INDEX_736(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_738(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 737)), TRLC_EXPAND_WITH_INDEX_737(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_739(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 738)), TRLC_EXPAND_WITH_INDEX_738(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_740(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 739)), TRLC_EXPAND_WITH_INDEX_739(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_741(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 740)), TRLC_EXPAND_WITH_INDEX_740(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_742(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 741)), TRLC_EXPAND_WITH_INDEX_741(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_743(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 742)), TRLC_EXPAND_WITH_INDEX_742(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_744(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 743)), TRLC_EXPAND_WITH_INDEX_743(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_745(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 744)), TRLC_EXPAND_WITH_INDEX_744(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_746(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 745)), TRLC_EXPAND_WITH_INDEX_745(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_747(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 746)), TRLC_EXPAND_WITH_INDEX_746(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_748(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 747)), TRLC_EXPAND_WITH_INDEX_747(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_749(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 748)), TRLC_EXPAND_WITH_INDEX_748(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_750(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 749)), TRLC_EXPAND_WITH_INDEX_749(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_751(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 750)), TRLC_EXPAND_WITH_INDEX_750(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_752(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 751)), TRLC_EXPAND_WITH_INDEX_751(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_753(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 752)), TRLC_EXPAND_WITH_INDEX_752(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_754(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 753)), TRLC_EXPAND_WITH_INDEX_753(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_755(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 754)), TRLC_EXPAND_WITH_INDEX_754(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_756(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 755)), TRLC_EXPAND_WITH_INDEX_755(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_757(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 756)), TRLC_EXPAND_WITH_INDEX_756(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_758(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 757)), TRLC_EXPAND_WITH_INDEX_757(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_759(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 758)), TRLC_EXPAND_WITH_INDEX_758(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_760(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 759)), TRLC_EXPAND_WITH_INDEX_759(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_761(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 760)), TRLC_EXPAND_WITH_INDEX_760(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_762(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 761)), TRLC_EXPAND_WITH_INDEX_761(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_763(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 762)), TRLC_EXPAND_WITH_INDEX_762(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_764(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 763)), TRLC_EXPAND_WITH_INDEX_763(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_765(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 764)), TRLC_EXPAND_WITH_INDEX_764(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_766(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 765)), TRLC_EXPAND_WITH_INDEX_765(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_767(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 766)), TRLC_EXPAND_WITH_INDEX_766(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_768(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 767)), TRLC_EXPAND_WITH_INDEX_767(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_769(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 768)), TRLC_EXPAND_WITH_INDEX_768(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_770(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 769)), TRLC_EXPAND_WITH_INDEX_769(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_771(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 770)), TRLC_EXPAND_WITH_INDEX_770(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_772(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 771)), TRLC_EXPAND_WITH_INDEX_771(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_773(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 772)), TRLC_EXPAND_WITH_INDEX_772(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_774(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 773)), TRLC_EXPAND_WITH_INDEX_773(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_775(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 774)), TRLC_EXPAND_WITH_INDEX_774(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_776(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 775)), TRLC_EXPAND_WITH_INDEX_775(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_777(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 776)), TRLC_EXPAND_WITH_INDEX_776(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_778(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 777)), TRLC_EXPAND_WITH_INDEX_777(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_779(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 778)), TRLC_EXPAND_WITH_INDEX_778(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_780(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 779)), TRLC_EXPAND_WITH_INDEX_779(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_781(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 780)), TRLC_EXPAND_WITH_INDEX_780(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_782(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 781)), TRLC_EXPAND_WITH_INDEX_781(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_783(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 782)), TRLC_EXPAND_WITH_INDEX_782(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_784(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 783)), TRLC_EXPAND_WITH_INDEX_783(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_785(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 784)), TRLC_EXPAND_WITH_INDEX_784(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_786(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 785)), TRLC_EXPAND_WITH_INDEX_785(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_787(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 786)), TRLC_EXPAND_WITH_INDEX_786(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_788(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 787)), TRLC_EXPAND_WITH_INDEX_787(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_789(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 788)), TRLC_EXPAND_WITH_INDEX_788(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_790(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 789)), TRLC_EXPAND_WITH_INDEX_789(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_791(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 790)), TRLC_EXPAND_WITH_INDEX_790(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_792(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 791)), TRLC_EXPAND_WITH_INDEX_791(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_793(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 792)), TRLC_EXPAND_WITH_INDEX_792(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_794(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 793)), TRLC_EXPAND_WITH_INDEX_793(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_795(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 794)), TRLC_EXPAND_WITH_INDEX_794(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_796(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 795)), TRLC_EXPAND_WITH_INDEX_795(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_797(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 796)), TRLC_EXPAND_WITH_INDEX_796(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_798(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 797)), TRLC_EXPAND_WITH_INDEX_797(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_799(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 798)), TRLC_EXPAND_WITH_INDEX_798(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_800(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 799)), TRLC_EXPAND_WITH_INDEX_799(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_801(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 800)), TRLC_EXPAND_WITH_INDEX_800(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_802(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 801)), TRLC_EXPAND_WITH_INDEX_801(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_803(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 802)), TRLC_EXPAND_WITH_INDEX_802(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_804(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 803)), TRLC_EXPAND_WITH_INDEX_803(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_805(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 804)), TRLC_EXPAND_WITH_INDEX_804(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_806(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 805)), TRLC_EXPAND_WITH_INDEX_805(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_807(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 806)), TRLC_EXPAND_WITH_INDEX_806(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_808(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 807)), TRLC_EXPAND_WITH_INDEX_807(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_809(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 808)), TRLC_EXPAND_WITH_INDEX_808(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_810(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 809)), TRLC_EXPAND_WITH_INDEX_809(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_811(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 810)), TRLC_EXPAND_WITH_INDEX_810(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_812(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 811)), TRLC_EXPAND_WITH_INDEX_811(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_813(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 812)), TRLC_EXPAND_WITH_INDEX_812(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_814(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 813)), TRLC_EXPAND_WITH_INDEX_813(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_815(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 814)), TRLC_EXPAND_WITH_INDEX_814(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_816(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 815)), TRLC_EXPAND_WITH_INDEX_815(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_817(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 816)), TRLC_EXPAND_WITH_INDEX_816(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_818(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 817)), TRLC_EXPAND_WITH_INDEX_817(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_819(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 818)), TRLC_EXPAND_WITH_INDEX_818(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_820(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 819)), TRLC_EXPAND_WITH_INDEX_819(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_821(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 820)), TRLC_EXPAND_WITH_INDEX_820(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_822(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 821)), TRLC_EXPAND_WITH_INDEX_821(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_823(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 822)), TRLC_EXPAND_WITH_INDEX_822(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_824(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 823)), TRLC_EXPAND_WITH_INDEX_823(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_825(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 824)), TRLC_EXPAND_WITH_INDEX_824(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_826(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 825)), TRLC_EXPAND_WITH_INDEX_825(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_827(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 826)), TRLC_EXPAND_WITH_INDEX_826(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_828(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 827)), TRLC_EXPAND_WITH_INDEX_827(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_829(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 828)), TRLC_EXPAND_WITH_INDEX_828(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_830(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 829)), TRLC_EXPAND_WITH_INDEX_829(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_831(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 830)), TRLC_EXPAND_WITH_INDEX_830(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_832(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 831)), TRLC_EXPAND_WITH_INDEX_831(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_833(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 832)), TRLC_EXPAND_WITH_INDEX_832(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_834(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 833)), TRLC_EXPAND_WITH_INDEX_833(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_835(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 834)), TRLC_EXPAND_WITH_INDEX_834(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_836(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 835)), TRLC_EXPAND_WITH_INDEX_835(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_837(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 836)), TRLC_EXPAND_WITH_INDEX_836(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_838(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 837)), TRLC_EXPAND_WITH_INDEX_837(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_839(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 838)), TRLC_EXPAND_WITH_INDEX_838(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_840(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 839)), TRLC_EXPAND_WITH_INDEX_839(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_841(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 840)), TRLC_EXPAND_WITH_INDEX_840(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_842(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 841)), TRLC_EXPAND_WITH_INDEX_841(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_843(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 842)), TRLC_EXPAND_WITH_INDEX_842(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_844(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 843)), TRLC_EXPAND_WITH_INDEX_843(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_845(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 844)), TRLC_EXPAND_WITH_INDEX_844(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_846(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 845)), TRLC_EXPAND_WITH_INDEX_845(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_847(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 846)), TRLC_EXPAND_WITH_INDEX_846(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_848(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 847)), TRLC_EXPAND_WITH_INDEX_847(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_849(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 848)), TRLC_EXPAND_WITH_INDEX_848(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_850(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 849)), TRLC_EXPAND_WITH_INDEX_849(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_851(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 850)), TRLC_EXPAND_WITH_INDEX_850(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_852(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 851)), TRLC_EXPAND_WITH_INDEX_851(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_853(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 852)), TRLC_EXPAND_WITH_INDEX_852(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_854(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 853)), TRLC_EXPAND_WITH_INDEX_853(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_855(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 854)), TRLC_EXPAND_WITH_INDEX_854(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_856(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 855)), TRLC_EXPAND_WITH_INDEX_855(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_857(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 856)), TRLC_EXPAND_WITH_INDEX_856(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_858(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 857)), TRLC_EXPAND_WITH_INDEX_857(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_859(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 858)), TRLC_EXPAND_WITH_INDEX_858(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_860(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 859)), TRLC_EXPAND_WITH_INDEX_859(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_861(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 860)), TRLC_EXPAND_WITH_INDEX_860(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_862(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 861)), TRLC_EXPAND_WITH_INDEX_861(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_863(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 862)), TRLC_EXPAND_WITH_INDEX_862(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_864(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 863)), TRLC_EXPAND_WITH_INDEX_863(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_865(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 864)), TRLC_EXPAND_WITH_INDEX_864(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_866(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 865)), TRLC_EXPAND_WITH_INDEX_865(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_867(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 866)), TRLC_EXPAND_WITH_INDEX_866(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_868(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 867)), TRLC_EXPAND_WITH_INDEX_867(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_869(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 868)), TRLC_EXPAND_WITH_INDEX_868(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_870(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 869)), TRLC_EXPAND_WITH_INDEX_869(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_871(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 870)), TRLC_EXPAND_WITH_INDEX_870(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_872(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 871)), TRLC_EXPAND_WITH_INDEX_871(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_873(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 872)), TRLC_EXPAND_WITH_INDEX_872(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_874(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 873)), TRLC_EXPAND_WITH_INDEX_873(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_875(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 874)), TRLC_EXPAND_WITH_INDEX_874(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_876(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 875)), TRLC_EXPAND_WITH_INDEX_875(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_877(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 876)), TRLC_EXPAND_WITH_INDEX_876(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_878(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 877)), TRLC_EXPAND_WITH_INDEX_877(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_879(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 878)), TRLC_EXPAND_WITH_INDEX_878(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_880(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 879)), TRLC_EXPAND_WITH_INDEX_879(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_881(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 880)), TRLC_EXPAND_WITH_INDEX_880(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_882(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 881)), TRLC_EXPAND_WITH_INDEX_881(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_883(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 882)), TRLC_EXPAND_WITH_INDEX_882(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_884(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 883)), TRLC_EXPAND_WITH_INDEX_883(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_885(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 884)), TRLC_EXPAND_WITH_INDEX_884(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_886(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 885)), TRLC_EXPAND_WITH_INDEX_885(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_887(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 886)), TRLC_EXPAND_WITH_INDEX_886(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_888(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 887)), TRLC_EXPAND_WITH_INDEX_887(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_889(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 888)), TRLC_EXPAND_WITH_INDEX_888(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_890(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 889)), TRLC_EXPAND_WITH_INDEX_889(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_891(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 890)), TRLC_EXPAND_WITH_INDEX_890(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_892(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 891)), TRLC_EXPAND_WITH_INDEX_891(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_893(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 892)), TRLC_EXPAND_WITH_INDEX_892(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_894(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 893)), TRLC_EXPAND_WITH_INDEX_893(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_895(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 894)), TRLC_EXPAND_WITH_INDEX_894(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_896(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 895)), TRLC_EXPAND_WITH_INDEX_895(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_897(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 896)), TRLC_EXPAND_WITH_INDEX_896(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_898(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 897)), TRLC_EXPAND_WITH_INDEX_897(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_899(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 898)), TRLC_EXPAND_WITH_INDEX_898(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_900(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 899)), TRLC_EXPAND_WITH_INDEX_899(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_901(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 900)), TRLC_EXPAND_WITH_INDEX_900(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_902(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 901)), TRLC_EXPAND_WITH_INDEX_901(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_903(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 902)), TRLC_EXPAND_WITH_INDEX_902(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_904(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 903)), TRLC_EXPAND_WITH_INDEX_903(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_905(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 904)), TRLC_EXPAND_WITH_INDEX_904(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_906(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 905)), TRLC_EXPAND_WITH_INDEX_905(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_907(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 906)), TRLC_EXPAND_WITH_INDEX_906(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_908(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 907)), TRLC_EXPAND_WITH_INDEX_907(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_909(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 908)), TRLC_EXPAND_WITH_INDEX_908(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_910(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 909)), TRLC_EXPAND_WITH_INDEX_909(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_911(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 910)), TRLC_EXPAND_WITH_INDEX_910(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_912(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 911)), TRLC_EXPAND_WITH_INDEX_911(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_913(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 912)), TRLC_EXPAND_WITH_INDEX_912(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_914(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 913)), TRLC_EXPAND_WITH_INDEX_913(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_915(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 914)), TRLC_EXPAND_WITH_INDEX_914(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_916(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 915)), TRLC_EXPAND_WITH_INDEX_915(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_917(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 916)), TRLC_EXPAND_WITH_INDEX_916(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_918(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 917)), TRLC_EXPAND_WITH_INDEX_917(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_919(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 918)), TRLC_EXPAND_WITH_INDEX_918(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_920(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 919)), TRLC_EXPAND_WITH_INDEX_919(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_921(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 920)), TRLC_EXPAND_WITH_INDEX_920(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_922(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 921)), TRLC_EXPAND_WITH_INDEX_921(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_923(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 922)), TRLC_EXPAND_WITH_INDEX_922(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_924(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 923)), TRLC_EXPAND_WITH_INDEX_923(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_925(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 924)), TRLC_EXPAND_WITH_INDEX_924(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_926(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 925)), TRLC_EXPAND_WITH_INDEX_925(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_927(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 926)), TRLC_EXPAND_WITH_INDEX_926(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_928(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 927)), TRLC_EXPAND_WITH_INDEX_927(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_929(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 928)), TRLC_EXPAND_WITH_INDEX_928(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_930(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 929)), TRLC_EXPAND_WITH_INDEX_929(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_931(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 930)), TRLC_EXPAND_WITH_INDEX_930(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_932(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 931)), TRLC_EXPAND_WITH_INDEX_931(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_933(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 932)), TRLC_EXPAND_WITH_INDEX_932(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_934(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 933)), TRLC_EXPAND_WITH_INDEX_933(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_935(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 934)), TRLC_EXPAND_WITH_INDEX_934(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_936(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 935)), TRLC_EXPAND_WITH_INDEX_935(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_937(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 936)), TRLC_EXPAND_WITH_INDEX_936(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_938(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 937)), TRLC_EXPAND_WITH_INDEX_937(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_939(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 938)), TRLC_EXPAND_WITH_INDEX_938(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_940(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 939)), TRLC_EXPAND_WITH_INDEX_939(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_941(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 940)), TRLC_EXPAND_WITH_INDEX_940(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_942(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 941)), TRLC_EXPAND_WITH_INDEX_941(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_943(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 942)), TRLC_EXPAND_WITH_INDEX_942(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_944(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 943)), TRLC_EXPAND_WITH_INDEX_943(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_945(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 944)), TRLC_EXPAND_WITH_INDEX_944(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_946(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 945)), TRLC_EXPAND_WITH_INDEX_945(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_947(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 946)), TRLC_EXPAND_WITH_INDEX_946(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_948(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 947)), TRLC_EXPAND_WITH_INDEX_947(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_949(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 948)), TRLC_EXPAND_WITH_INDEX_948(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_950(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 949)), TRLC_EXPAND_WITH_INDEX_949(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_951(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 950)), TRLC_EXPAND_WITH_INDEX_950(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_952(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 951)), TRLC_EXPAND_WITH_INDEX_951(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_953(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 952)), TRLC_EXPAND_WITH_INDEX_952(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_954(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 953)), TRLC_EXPAND_WITH_INDEX_953(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_955(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 954)), TRLC_EXPAND_WITH_INDEX_954(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_956(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 955)), TRLC_EXPAND_WITH_INDEX_955(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_957(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 956)), TRLC_EXPAND_WITH_INDEX_956(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_958(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 957)), TRLC_EXPAND_WITH_INDEX_957(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_959(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 958)), TRLC_EXPAND_WITH_INDEX_958(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_960(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 959)), TRLC_EXPAND_WITH_INDEX_959(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_961(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 960)), TRLC_EXPAND_WITH_INDEX_960(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_962(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 961)), TRLC_EXPAND_WITH_INDEX_961(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_963(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 962)), TRLC_EXPAND_WITH_INDEX_962(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_964(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 963)), TRLC_EXPAND_WITH_INDEX_963(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_965(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 964)), TRLC_EXPAND_WITH_INDEX_964(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_966(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 965)), TRLC_EXPAND_WITH_INDEX_965(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_967(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 966)), TRLC_EXPAND_WITH_INDEX_966(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_968(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 967)), TRLC_EXPAND_WITH_INDEX_967(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_969(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 968)), TRLC_EXPAND_WITH_INDEX_968(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_970(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 969)), TRLC_EXPAND_WITH_INDEX_969(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_971(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 970)), TRLC_EXPAND_WITH_INDEX_970(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_972(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 971)), TRLC_EXPAND_WITH_INDEX_971(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_973(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 972)), TRLC_EXPAND_WITH_INDEX_972(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_974(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 973)), TRLC_EXPAND_WITH_INDEX_973(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_975(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 974)), TRLC_EXPAND_WITH_INDEX_974(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_976(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 975)), TRLC_EXPAND_WITH_INDEX_975(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_977(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 976)), TRLC_EXPAND_WITH_INDEX_976(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_978(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 977)), TRLC_EXPAND_WITH_INDEX_977(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_979(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 978)), TRLC_EXPAND_WITH_INDEX_978(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_980(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 979)), TRLC_EXPAND_WITH_INDEX_979(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_981(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 980)), TRLC_EXPAND_WITH_INDEX_980(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_982(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 981)), TRLC_EXPAND_WITH_INDEX_981(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_983(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 982)), TRLC_EXPAND_WITH_INDEX_982(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_984(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 983)), TRLC_EXPAND_WITH_INDEX_983(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_985(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 984)), TRLC_EXPAND_WITH_INDEX_984(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_986(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 985)), TRLC_EXPAND_WITH_INDEX_985(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_987(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 986)), TRLC_EXPAND_WITH_INDEX_986(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_988(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 987)), TRLC_EXPAND_WITH_INDEX_987(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_989(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 988)), TRLC_EXPAND_WITH_INDEX_988(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_990(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 989)), TRLC_EXPAND_WITH_INDEX_989(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_991(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 990)), TRLC_EXPAND_WITH_INDEX_990(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_992(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 991)), TRLC_EXPAND_WITH_INDEX_991(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_993(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 992)), TRLC_EXPAND_WITH_INDEX_992(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_994(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 993)), TRLC_EXPAND_WITH_INDEX_993(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_995(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 994)), TRLC_EXPAND_WITH_INDEX_994(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_996(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 995)), TRLC_EXPAND_WITH_INDEX_995(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_997(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 996)), TRLC_EXPAND_WITH_INDEX_996(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_998(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 997)), TRLC_EXPAND_WITH_INDEX_997(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_999(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 998)), TRLC_EXPAND_WITH_INDEX_998(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1000(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 999)), TRLC_EXPAND_WITH_INDEX_999(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1001(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1000)), TRLC_EXPAND_WITH_INDEX_1000(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1002(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1001)), TRLC_EXPAND_WITH_INDEX_1001(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1003(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1002)), TRLC_EXPAND_WITH_INDEX_1002(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1004(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1003)), TRLC_EXPAND_WITH_INDEX_1003(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1005(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1004)), TRLC_EXPAND_WITH_INDEX_1004(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1006(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1005)), TRLC_EXPAND_WITH_INDEX_1005(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1007(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1006)), TRLC_EXPAND_WITH_INDEX_1006(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1008(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1007)), TRLC_EXPAND_WITH_INDEX_1007(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1009(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1008)), TRLC_EXPAND_WITH_INDEX_1008(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1010(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1009)), TRLC_EXPAND_WITH_INDEX_1009(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1011(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1010)), TRLC_EXPAND_WITH_INDEX_1010(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1012(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1011)), TRLC_EXPAND_WITH_INDEX_1011(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1013(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1012)), TRLC_EXPAND_WITH_INDEX_1012(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1014(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1013)), TRLC_EXPAND_WITH_INDEX_1013(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1015(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1014)), TRLC_EXPAND_WITH_INDEX_1014(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1016(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1015)), TRLC_EXPAND_WITH_INDEX_1015(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1017(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1016)), TRLC_EXPAND_WITH_INDEX_1016(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1018(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1017)), TRLC_EXPAND_WITH_INDEX_1017(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1019(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1018)), TRLC_EXPAND_WITH_INDEX_1018(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1020(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1019)), TRLC_EXPAND_WITH_INDEX_1019(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1021(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1020)), TRLC_EXPAND_WITH_INDEX_1020(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1022(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1021)), TRLC_EXPAND_WITH_INDEX_1021(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1023(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1022)), TRLC_EXPAND_WITH_INDEX_1022(MACRO, COUNT, __VA_ARGS__)
+#define TRLC_EXPAND_WITH_INDEX_1024(MACRO, COUNT, arg1, ...) MACRO(arg1, (COUNT - 1023)), TRLC_EXPAND_WITH_INDEX_1023(MACRO, COUNT, __VA_ARGS__)
+
+// clang-format on
+
@@ -16,65 +16,44 @@ def generate_macros(n):
     count_args_macro = f"#define TRLC_COUNT_ARGS(...) TRLC_COUNT_ARGS_IMPL(__VA_ARGS__, {', '.join(map(str, range(n, 0, -1)))})"
     count_args_impl_macro = f"#define TRLC_COUNT_ARGS_IMPL({', '.join([f'_{i}' for i in range(1, n + 1)])}, N, ...) N"
 
-    # Generate recursive APPLY_* macros
-    apply_impl_macros = ""
-    for i in range(1, n + 1):
-        args = ", ".join([f"arg{j}" for j in range(1, i + 1)])
-        apply_impl_macros += f"#define TRLC_APPLY_{i}(MACRO, {args}) "
-        apply_impl_macros += "".join([f"MACRO(arg{j}); " for j in range(1, i + 1)])
-        apply_impl_macros += "\n"
-
-    # Generate APPLY and recursive expansion macros with indexing
+    # Generate recursive APPLY_* macros.
+    # Every macro handles its first argument and forwards the rest to the previous one,
+    # so the generated headers grow linearly with n.
+    apply_impl_macros = "#define TRLC_APPLY_1(MACRO, arg1) MACRO(arg1);\n"
+    for i in range(2, n + 1):
+        apply_impl_macros += f"#define TRLC_APPLY_{i}(MACRO, arg1, ...) MACRO(arg1); TRLC_APPLY_{i - 1}(MACRO, __VA_ARGS__)\n"
+
+    # Generate APPLY and recursive expansion macros with indexing.
+    # The index of the first argument of TRLC_APPLY_WITH_INDEX_i is COUNT - i + 1.
     apply_impl_macros_with_index = "\n".join(
-        [
-            f"#define TRLC_APPLY_WITH_INDEX_{i}(MACRO, "
-            + ", ".join([f"arg{j}" for j in range(1, i + 1)])
-            + ") "
-            + (
-                "MACRO(arg1, 1); "
-                + "".join([f"MACRO(arg{j}, {j}); " for j in range(2, i + 1)])
-                if i > 1
-                else "MACRO(arg1, 1);"
-            )
-            for i in range(1, n + 1)
+        ["#define TRLC_APPLY_WITH_INDEX_1(MACRO, COUNT, arg1) MACRO(arg1, (COUNT));"]
+        + [
+            f"#define TRLC_APPLY_WITH_INDEX_{i}(MACRO, COUNT, arg1, ...) "
+            f"MACRO(arg1, (COUNT - {i - 1})); TRLC_APPLY_WITH_INDEX_{i - 1}(MACRO, COUNT, __VA_ARGS__)"
+            for i in range(2, n + 1)
         ]
     )
 
     # Generate recursive EXPAND_* macros
-    expand_impl_macros = ""
-    for i in range(1, n + 1):
-        args = ", ".join([f"arg{j}" for j in range(1, i + 1)])
-        expand_impl_macros += f"#define TRLC_EXPAND_{i}(MACRO, {args}) "
-
-        # Use a generator expression to join MACRO calls without a trailing comma
-        expand_impl_macros += ", ".join([f"MACRO(arg{j})" for j in range(1, i + 1)])
-        expand_impl_macros += "\n"
+    expand_impl_macros = "#define TRLC_EXPAND_1(MACRO, arg1) MACRO(arg1)\n"
+    for i in range(2, n + 1):
+        expand_impl_macros += f"#define TRLC_EXPAND_{i}(MACRO, arg1, ...) MACRO(arg1), TRLC_EXPAND_{i - 1}(MACRO, __VA_ARGS__)\n"
 
     # Generate EXPAND and recursive expansion macros with indexing
     expand_impl_macros_with_index = "\n".join(
-        [
-            f"#define TRLC_EXPAND_WITH_INDEX_{i}(MACRO, "
-            + ", ".join([f"arg{j}" for j in range(1, i + 1)])
-            + ") "
-            + (
-                "MACRO(arg1, 1)"
-                + "".join([f", MACRO(arg{j}, {j})" for j in range(2, i + 1)])
-                if i > 1
-                else "MACRO(arg1, 1)"
-            )
-            for i in range(1, n + 1)
+        ["#define TRLC_EXPAND_WITH_INDEX_1(MACRO, COUNT, arg1) MACRO(arg1, (COUNT))"]
+        + [
+            f"#define TRLC_EXPAND_WITH_INDEX_{i}(MACRO, COUNT, arg1, ...) "
+            f"MACRO(arg1, (COUNT - {i - 1})), TRLC_EXPAND_WITH_INDEX_{i - 1}(MACRO, COUNT, __VA_ARGS__)"
+            for i in range(2, n + 1)
         ]
     )
 
-    # Generate recursive APPEND_* macros
-    append_impl_macros = ""
-    for i in range(1, n + 1):
-        args = ",".join([f"arg{j}" for j in range(1, i + 1)])
-        append_impl_macros += f"#define TRLC_APPEND_{i}(MACRO, delim, {args}) "
-
-        # Use a generator expression to join MACRO calls without a trailing comma
-        append_impl_macros += "MACRO(" + "##delim##".join([f"arg{j}" for j in range(1, i + 1)])
-        append_impl_macros += ")\n"
+    # Generate recursive APPEND_* macros, pasting the first two arguments at every step
+    append_impl_macros = "#define TRLC_APPEND_1(MACRO, delim, arg1) MACRO(arg1)\n"
+    append_impl_macros += "#define TRLC_APPEND_2(MACRO, delim, arg1, arg2) MACRO(arg1##delim##arg2)\n"
+    for i in range(3, n + 1):
+        append_impl_macros += f"#define TRLC_APPEND_{i}(MACRO, delim, arg1, arg2, ...) TRLC_APPEND_{i - 1}(MACRO, delim, arg1##delim##arg2, __VA_ARGS__)\n"
 
     # Generate APPLY macros
     apply_macros = "#define TRLC_APPLY(MACRO, ...) TRLC_APPLY_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)\n"
@@ -94,12 +73,12 @@ def generate_macros(n):
     # Generate APPLY_WITH_INDEX macros
     apply_with_index_macros = "#define TRLC_APPLY_WITH_INDEX(MACRO, ...) TRLC_APPLY_WITH_INDEX_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)\n"
     apply_with_index_macros += "#define TRLC_APPLY_WITH_INDEX_IMPL(MACRO, COUNT, ...) TRLC_APPLY_WITH_INDEX_IMPL2(MACRO, COUNT, __VA_ARGS__)\n"
-    apply_with_index_macros += "#define TRLC_APPLY_WITH_INDEX_IMPL2(MACRO, COUNT, ...) TRLC_APPLY_WITH_INDEX_##COUNT(MACRO, __VA_ARGS__)"
+    apply_with_index_macros += "#define TRLC_APPLY_WITH_INDEX_IMPL2(MACRO, COUNT, ...) TRLC_APPLY_WITH_INDEX_##COUNT(MACRO, COUNT, __VA_ARGS__)"
 
     # Generate EXPAND_WITH_INDEX macros
     expand_with_index_macros = "#define TRLC_EXPAND_WITH_INDEX(MACRO, ...) TRLC_EXPAND_WITH_INDEX_IMPL(MACRO, TRLC_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)\n"
     expand_with_index_macros += "#define TRLC_EXPAND_WITH_INDEX_IMPL(MACRO, COUNT, ...) TRLC_EXPAND_WITH_INDEX_IMPL2(MACRO, COUNT, __VA_ARGS__)\n"
-    expand_with_index_macros += "#define TRLC_EXPAND_WITH_INDEX_IMPL2(MACRO, COUNT, ...) TRLC_EXPAND_WITH_INDEX_##COUNT(MACRO, __VA_ARGS__)"
+    expand_with_index_macros += "#define TRLC_EXPAND_WITH_INDEX_IMPL2(MACRO, COUNT, ...) TRLC_EXPAND_WITH_INDEX_##COUNT(MACRO, COUNT, __VA_ARGS__)"
 
     header = """
 /**
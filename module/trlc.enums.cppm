@@ -0,0 +1,42 @@
+module;
+
+// The standard headers used by the library are included in the global module fragment,
+// so that their include guards keep them out of the module purview below.
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#endif
+
+export module trlc.enums;
+
+// Every entity of the library is exported, including the ones named by the expansion of
+// TRLC_ENUM_DETAIL. Macros cannot be exported from a module, importers declare their enums
+// with the macros of trlc/enum/macros.hpp.
+export extern "C++"
+{
+#include "trlc/enum.hpp"
+#include "trlc/enum/batch.hpp"
+#include "trlc/enum/instrumented.hpp"
+}
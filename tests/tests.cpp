@@ -1,7 +1,17 @@
 #include "trlc/enum.hpp" // Include your enum library header
+#include "trlc/enum/batch.hpp"
+#include "trlc/enum/instrumented.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 // Define new enums for testing
 TRLC_ENUM(Colors,
           RED,
@@ -28,6 +38,225 @@ TRLC_ENUM(Validate,
           NEGATIVE_VALUE = TRLC_FIELD(value = -100, desc = "Default trlc enum can support negative value."),
           END)
 
+TRLC_ENUM(WideValues,
+          SMALLEST = TRLC_FIELD(value = -5000000000, desc = "Below the int32 range."),
+          LARGEST = TRLC_FIELD(value = 9000000000000000000, desc = "Above the int32 range."))
+
+TRLC_ENUM(Gaps,
+          FIRST = TRLC_FIELD(value = 1),
+          SECOND,
+          THIRD,
+          FOURTH = TRLC_FIELD(value = 3),
+          FIFTH)
+
+template<class Holder>
+using DenseTableEnumDef = trlc::DefaultEnumDef<Holder, trlc::policy::DenseTableSearchPolicy>;
+
+TRLC_ENUM_DETAIL(Opcodes, DenseTableEnumDef,
+                 NOP = TRLC_FIELD(value = -2),
+                 LOAD,
+                 STORE,
+                 JUMP = TRLC_FIELD(value = 4),
+                 HALT = TRLC_FIELD(value = 6))
+
+TRLC_ENUM_DETAIL(SparseOpcodes, DenseTableEnumDef,
+                 FIRST = TRLC_FIELD(value = -1000),
+                 SECOND,
+                 THIRD = TRLC_FIELD(value = 1000))
+
+template<class Holder>
+struct Int32EnumDef : trlc::DefaultEnumDef<Holder>
+{
+    using value_type = int32_t;
+    using enum_type = trlc::CompactEnum<value_type, Holder>;
+};
+
+TRLC_ENUM_DETAIL(LogLevels, Int32EnumDef,
+                 TRACE = TRLC_FIELD(value = -1),
+                 DEBUG,
+                 INFO,
+                 WARN,
+                 ERROR,
+                 FATAL)
+
+template<class Holder>
+using PerfectHashEnumDef = trlc::DefaultEnumDef<Holder, trlc::policy::BinarySearchPolicy, trlc::policy::PerfectHashStringSearchPolicy>;
+
+TRLC_ENUM_DETAIL(HttpHeaders, PerfectHashEnumDef,
+                 ACCEPT,
+                 ACCEPT_CHARSET,
+                 ACCEPT_ENCODING,
+                 ACCEPT_LANGUAGE,
+                 AUTHORIZATION,
+                 CACHE_CONTROL,
+                 CONNECTION,
+                 CONTENT_ENCODING,
+                 CONTENT_LENGTH,
+                 CONTENT_TYPE,
+                 COOKIE,
+                 DATE,
+                 ETAG,
+                 EXPECT,
+                 HOST,
+                 IF_MATCH,
+                 IF_MODIFIED_SINCE,
+                 IF_NONE_MATCH,
+                 LOCATION,
+                 ORIGIN,
+                 PRAGMA,
+                 RANGE,
+                 REFERER,
+                 SERVER,
+                 SET_COOKIE,
+                 TE,
+                 TRAILER,
+                 UPGRADE,
+                 USER_AGENT,
+                 VARY,
+                 VIA,
+                 WARNING)
+
+template<class Holder>
+using LengthBucketedEnumDef = trlc::DefaultEnumDef<Holder, trlc::policy::BinarySearchPolicy, trlc::policy::LengthBucketedStringSearchPolicy>;
+
+TRLC_ENUM_DETAIL(HttpMethods, LengthBucketedEnumDef,
+                 GET,
+                 PUT,
+                 POST,
+                 HEAD,
+                 DELETE,
+                 OPTIONS,
+                 PROPFIND,
+                 PROPPATCH,
+                 CONNECT_PROXY_A,
+                 CONNECT_PROXY_B,
+                 UNSUBSCRIBE_ALL_LISTENERS)
+
+template<class Holder>
+using CaseInsensitivePerfectHashEnumDef = trlc::DefaultEnumDef<Holder, trlc::policy::BinarySearchPolicy, trlc::policy::CaseInsensitivePerfectHashStringSearchPolicy>;
+
+TRLC_ENUM_DETAIL(ContentEncodings, CaseInsensitivePerfectHashEnumDef,
+                 Identity,
+                 Gzip,
+                 Deflate,
+                 Compress,
+                 Br,
+                 Zstd,
+                 X_Custom_Encoding_With_Long_Name)
+
+template<class Holder>
+struct CompactEnumDef : trlc::DefaultEnumDef<Holder>
+{
+    using enum_type = trlc::CompactEnum<int64_t, Holder>;
+};
+
+TRLC_ENUM_DETAIL(CompactStatus, CompactEnumDef,
+                 IDLE = TRLC_FIELD(value = 10, desc = "Nothing to do."),
+                 RUNNING,
+                 FAILED = TRLC_FIELD(value = -1, desc = "Gave up."),
+                 DONE = TRLC_FIELD(value = 42))
+
+template<class Holder>
+using InstrumentedEnumDef = trlc::DefaultEnumDef<Holder,
+                                                 trlc::policy::InstrumentedPolicy<trlc::policy::BinarySearchPolicy, true>,
+                                                 trlc::policy::InstrumentedPolicy<trlc::policy::CaseSensitiveStringSearchPolicy>>;
+
+TRLC_ENUM_DETAIL(Responses, InstrumentedEnumDef,
+                 OK = TRLC_FIELD(value = 200),
+                 NOT_FOUND = TRLC_FIELD(value = 404),
+                 ERROR = TRLC_FIELD(value = 500))
+
+template<class Holder>
+struct CaptureEnumDef : trlc::DefaultEnumDef<Holder>
+{
+    using unknown_policy = trlc::policy::CaptureUnknownPolicy<4, 16>;
+};
+
+TRLC_ENUM_DETAIL(Commands, CaptureEnumDef,
+                 NOP,
+                 LOAD,
+                 STORE)
+
+template<class Holder>
+struct DefaultOnUnknownEnumDef : trlc::DefaultEnumDef<Holder, trlc::policy::LinearSearchPolicy>
+{
+    using unknown_policy = trlc::policy::DefaultOnUnknownPolicy;
+};
+
+TRLC_ENUM_DETAIL(Replies, DefaultOnUnknownEnumDef,
+                 ACCEPTED = TRLC_FIELD(value = 1),
+                 REJECTED = TRLC_FIELD(value = 2, desc = "Not an unknown reply."),
+                 UNRECOGNIZED = TRLC_FIELD(value = 99, desc = "Any other reply.", unknown = true))
+
+template<class Holder>
+struct PooledEnumDef : trlc::DefaultEnumDef<Holder>
+{
+    using enum_type = trlc::CompactEnum<int64_t, Holder, trlc::policy::PooledStoragePolicy>;
+};
+
+TRLC_ENUM_DETAIL(PooledStatus, PooledEnumDef,
+                 IDLE = TRLC_FIELD(value = 10, desc = "Nothing to do."),
+                 RUNNING,
+                 FAILED = TRLC_FIELD(value = -1, desc = "Gave up."),
+                 DONE = TRLC_FIELD(value = 42))
+
+template<class Holder>
+using EytzingerEnumDef = trlc::DefaultEnumDef<Holder, trlc::policy::EytzingerSearchPolicy>;
+
+TRLC_ENUM_DETAIL(ErrorCodes, EytzingerEnumDef,
+                 E_TIMEOUT = TRLC_FIELD(value = 110),
+                 E_NOENT = TRLC_FIELD(value = 2),
+                 E_PERM = TRLC_FIELD(value = 1),
+                 E_IO = TRLC_FIELD(value = 5),
+                 E_AGAIN = TRLC_FIELD(value = 11),
+                 E_NOMEM = TRLC_FIELD(value = 12),
+                 E_ACCES = TRLC_FIELD(value = 13),
+                 E_EXIST = TRLC_FIELD(value = 17),
+                 E_INVAL = TRLC_FIELD(value = 22),
+                 E_PIPE = TRLC_FIELD(value = 32),
+                 E_RANGE = TRLC_FIELD(value = 34),
+                 E_CONNRESET = TRLC_FIELD(value = 104),
+                 E_VENDOR_LOW = TRLC_FIELD(value = -9000000000000000000),
+                 E_VENDOR_HIGH = TRLC_FIELD(value = 9000000000000000000))
+
+TRLC_ENUM_DETAIL(Signals, trlc::AutoEnumDef,
+                 SIGTERM_ = TRLC_FIELD(value = 15),
+                 SIGHUP_ = TRLC_FIELD(value = 1),
+                 SIGKILL_ = TRLC_FIELD(value = 9),
+                 SIGINT_ = TRLC_FIELD(value = 2),
+                 SIGRTMIN_ = TRLC_FIELD(value = 34))
+
+TRLC_ENUM_DETAIL(Weekdays, trlc::AutoEnumDef,
+                 MONDAY,
+                 TUESDAY,
+                 WEDNESDAY,
+                 THURSDAY,
+                 FRIDAY,
+                 SATURDAY,
+                 SUNDAY)
+
+TRLC_ENUM_DETAIL(Ports, trlc::AutoEnumDef,
+                 FTP = TRLC_FIELD(value = 21),
+                 SSH = TRLC_FIELD(value = 22),
+                 TELNET = TRLC_FIELD(value = 23),
+                 SMTP = TRLC_FIELD(value = 25),
+                 DNS = TRLC_FIELD(value = 53),
+                 HTTP = TRLC_FIELD(value = 80),
+                 POP3 = TRLC_FIELD(value = 110),
+                 IMAP = TRLC_FIELD(value = 143),
+                 SNMP = TRLC_FIELD(value = 161),
+                 LDAP = TRLC_FIELD(value = 389),
+                 HTTPS = TRLC_FIELD(value = 443),
+                 SMTPS = TRLC_FIELD(value = 465),
+                 SUBMISSION = TRLC_FIELD(value = 587),
+                 LDAPS = TRLC_FIELD(value = 636),
+                 IMAPS = TRLC_FIELD(value = 993),
+                 POP3S = TRLC_FIELD(value = 995),
+                 MYSQL = TRLC_FIELD(value = 3306),
+                 RDP = TRLC_FIELD(value = 3389),
+                 POSTGRES = TRLC_FIELD(value = 5432),
+                 REDIS = TRLC_FIELD(value = 6379))
+
 // Tests for Validate Enum
 TEST(ValidateTest, ValidateAttributes)
 {
@@ -192,6 +421,927 @@ TEST(EnumIterateAndDumpTest, StatusCodesIterateAndDump)
     }
 }
 
+TEST(DenseTableSearchPolicyTest, DenseFromValue)
+{
+    static_assert(trlc::policy::DenseTableSearchPolicy::isDense<Opcodes>());
+    static_assert(Opcodes::fromValue(4).value() == Opcodes::JUMP);
+
+    EXPECT_EQ(Opcodes::fromValue(-2).value(), Opcodes::NOP);
+    EXPECT_EQ(Opcodes::fromValue(0).value(), Opcodes::LOAD);
+    EXPECT_EQ(Opcodes::fromValue(1).value(), Opcodes::STORE);
+    EXPECT_EQ(Opcodes::fromValue(6).value(), Opcodes::HALT);
+
+    // Holes, values before the minimum and after the maximum
+    EXPECT_FALSE(Opcodes::fromValue(-1).has_value());
+    EXPECT_FALSE(Opcodes::fromValue(5).has_value());
+    EXPECT_FALSE(Opcodes::fromValue(-3).has_value());
+    EXPECT_FALSE(Opcodes::fromValue(7).has_value());
+    EXPECT_FALSE(Opcodes::fromValue(std::numeric_limits<int64_t>::min()).has_value());
+    EXPECT_FALSE(Opcodes::fromValue(std::numeric_limits<int64_t>::max()).has_value());
+}
+
+TEST(DenseTableSearchPolicyTest, SparseFallback)
+{
+    static_assert(!trlc::policy::DenseTableSearchPolicy::isDense<SparseOpcodes>());
+
+    EXPECT_EQ(SparseOpcodes::fromValue(-1000).value(), SparseOpcodes::FIRST);
+    EXPECT_EQ(SparseOpcodes::fromValue(0).value(), SparseOpcodes::SECOND);
+    EXPECT_EQ(SparseOpcodes::fromValue(1000).value(), SparseOpcodes::THIRD);
+    EXPECT_FALSE(SparseOpcodes::fromValue(1).has_value());
+}
+
+TEST(PerfectHashStringSearchPolicyTest, ValidStrings)
+{
+    static_assert(HttpHeaders::fromString("IF_MODIFIED_SINCE").value() == HttpHeaders::IF_MODIFIED_SINCE);
+
+    for (auto elem : HttpHeaders::iterator)
+    {
+        auto found = HttpHeaders::fromString(elem.name());
+        ASSERT_TRUE(found.has_value());
+        EXPECT_EQ(found.value(), elem);
+    }
+}
+
+TEST(PerfectHashStringSearchPolicyTest, InvalidStrings)
+{
+    EXPECT_FALSE(HttpHeaders::fromString("").has_value());
+    EXPECT_FALSE(HttpHeaders::fromString("accept").has_value());
+    EXPECT_FALSE(HttpHeaders::fromString("ACCEPT_").has_value());
+    EXPECT_FALSE(HttpHeaders::fromString("ACCEP").has_value());
+    EXPECT_FALSE(HttpHeaders::fromString("X_FORWARDED_FOR").has_value());
+}
+
+TEST(CaseInsensitivePerfectHashStringSearchPolicyTest, ValidStrings)
+{
+    static_assert(ContentEncodings::fromString("GZIP").value() == ContentEncodings::Gzip);
+
+    EXPECT_EQ(ContentEncodings::fromString("identity").value(), ContentEncodings::Identity);
+    EXPECT_EQ(ContentEncodings::fromString("DEFLATE").value(), ContentEncodings::Deflate);
+    EXPECT_EQ(ContentEncodings::fromString("cOmPrEsS").value(), ContentEncodings::Compress);
+    EXPECT_EQ(ContentEncodings::fromString("br").value(), ContentEncodings::Br);
+    EXPECT_EQ(ContentEncodings::fromString("Zstd").value(), ContentEncodings::Zstd);
+    EXPECT_EQ(ContentEncodings::fromString("x_custom_ENCODING_with_long_NAME").value(), ContentEncodings::X_Custom_Encoding_With_Long_Name);
+}
+
+TEST(CaseInsensitivePerfectHashStringSearchPolicyTest, InvalidStrings)
+{
+    EXPECT_FALSE(ContentEncodings::fromString("").has_value());
+    EXPECT_FALSE(ContentEncodings::fromString("gzip ").has_value());
+    EXPECT_FALSE(ContentEncodings::fromString("g\xc7ip").has_value());
+    EXPECT_FALSE(ContentEncodings::fromString("x_custom_encoding_with_long_nam").has_value());
+    EXPECT_FALSE(ContentEncodings::fromString("x_custom_encoding_with_long_name_").has_value());
+    EXPECT_FALSE(ContentEncodings::fromString("x-custom-encoding-with-long-name").has_value());
+}
+
+TEST(ConstexprUtilsTest, ToLowerAscii)
+{
+    using trlc::constexpr_utils::load_u64;
+    using trlc::constexpr_utils::to_lower_ascii;
+    static_assert(to_lower_ascii(load_u64("AZaz@[`{")) == load_u64("azaz@[`{"));
+    static_assert(to_lower_ascii(load_u64("\xc1\xdaGZIP09")) == load_u64("\xc1\xdagzip09"));
+}
+
+TEST(CompactEnumTest, Attributes)
+{
+    static_assert(sizeof(CompactStatus::enum_type) == 1);
+    static_assert(CompactStatus::IDLE.value() == 10);
+    static_assert(CompactStatus::IDLE.name() == "IDLE");
+    static_assert(CompactStatus::IDLE.desc() == "Nothing to do.");
+    static_assert(CompactStatus::RUNNING.value() == 0);
+    static_assert(CompactStatus::FAILED.tag() == "CompactStatus");
+
+    EXPECT_EQ(CompactStatus::FAILED.value(), -1);
+    EXPECT_EQ(CompactStatus::FAILED.desc(), "Gave up.");
+    EXPECT_EQ(CompactStatus::DONE.name(), "DONE");
+    EXPECT_EQ(CompactStatus::DONE.holder().RUNNING, CompactStatus::RUNNING);
+    EXPECT_EQ(static_cast<int64_t>(CompactStatus::DONE), 42);
+    EXPECT_NE(CompactStatus::IDLE, CompactStatus::DONE);
+    EXPECT_EQ((CompactStatus::enum_type{10, "", ""}), CompactStatus::IDLE);
+    EXPECT_THROW((CompactStatus::enum_type{11, "", ""}), std::invalid_argument);
+}
+
+TEST(CompactEnumTest, Lookup)
+{
+    static_assert(CompactStatus::fromValue(42).value() == CompactStatus::DONE);
+    static_assert(CompactStatus::fromString("RUNNING").value() == CompactStatus::RUNNING);
+
+    EXPECT_EQ(CompactStatus::fromValue(-1).value(), CompactStatus::FAILED);
+    EXPECT_EQ(CompactStatus::fromString("IDLE").value(), CompactStatus::IDLE);
+    EXPECT_FALSE(CompactStatus::fromValue(1).has_value());
+    EXPECT_FALSE(CompactStatus::fromString("idle").has_value());
+}
+
+TEST(CompactEnumTest, IterateAndDump)
+{
+    std::vector<int64_t> values{};
+    for (auto elem : CompactStatus::iterator)
+    {
+        values.push_back(elem.value());
+    }
+    EXPECT_EQ(values, (std::vector<int64_t>{-1, 0, 10, 42}));
+
+    EXPECT_EQ(CompactStatus::IDLE.dump(), R"({"tag": "CompactStatus, "value": 10, "name": "IDLE", "desc": "Nothing to do."})");
+    EXPECT_NE(CompactStatus::dump().find("Gave up."), std::string::npos);
+}
+
+TEST(CompactEnumTest, SortedArrays)
+{
+    static_assert(std::is_same_v<decltype(trlc::sorted_values<CompactStatus>), const std::array<int64_t, 4>>);
+    static_assert(trlc::sorted_values<CompactStatus>[0] == -1);
+    static_assert(trlc::sorted_values<CompactStatus>[3] == 42);
+    static_assert(trlc::sorted_names<CompactStatus>[1] == "RUNNING");
+
+    for (auto elem : Validate::iterator)
+    {
+        EXPECT_EQ(trlc::sorted_values<Validate>[elem.ordinal()], elem.value());
+        EXPECT_EQ(trlc::sorted_names<Validate>[elem.ordinal()], elem.name());
+    }
+}
+
+TEST(CompactEnumTest, PooledStorage)
+{
+    static_assert(sizeof(PooledStatus::enum_type) == 1);
+    static_assert(sizeof(trlc::string_pool<PooledStatus>.m_offsets[0]) == 1);
+    static_assert(PooledStatus::IDLE.name() == "IDLE");
+    static_assert(PooledStatus::IDLE.desc() == "Nothing to do.");
+    static_assert(PooledStatus::RUNNING.desc().empty());
+    static_assert(PooledStatus::fromString("FAILED").value() == PooledStatus::FAILED);
+
+    EXPECT_EQ(trlc::string_pool<PooledStatus>.m_chars.size(), std::string_view{"FAILEDGave up.RUNNINGIDLENothing to do.DONE"}.size());
+    for (auto elem : PooledStatus::iterator)
+    {
+        const auto compact = CompactStatus::fromValue(elem.value()).value();
+        EXPECT_EQ(elem.name(), compact.name());
+        EXPECT_EQ(elem.desc(), compact.desc());
+        EXPECT_EQ(elem.ordinal(), compact.ordinal());
+    }
+    EXPECT_EQ(PooledStatus::DONE.dump(), R"({"tag": "PooledStatus, "value": 42, "name": "DONE", "desc": ""})");
+    EXPECT_FALSE(PooledStatus::fromString("Gave up.").has_value());
+}
+
+TEST(EnumMapTest, Ordinal)
+{
+    static_assert(Validate::NEGATIVE_VALUE.ordinal() == 0);
+    static_assert(Validate::FULL_FIELD.ordinal() == Validate::size() - 1);
+    static_assert(CompactStatus::FAILED.ordinal() == 0);
+    static_assert(CompactStatus::DONE.ordinal() == 3);
+    static_assert(Vehicles::enum_type{Vehicles::TRUCK.value(), "CUSTOM", "mine"}.ordinal() == Vehicles::TRUCK.ordinal());
+    static_assert(sizeof(Vehicles::enum_type) == sizeof(int64_t) + 2 * sizeof(std::string_view));
+    static_assert(Opcodes::JUMP.ordinal() == 3 && Opcodes::HALT.ordinal() == 4);
+    static_assert(WideValues::LARGEST.ordinal() == 1);
+    static_assert(trlc::ordinal_of<Vehicles>(int64_t{5}) == Vehicles::size());
+    static_assert(trlc::ordinal_of<Opcodes>(int64_t{5}) == Opcodes::size());
+    static_assert(trlc::ordinal_of<CompactStatus>(int64_t{7}) == CompactStatus::size());
+
+    size_t expected{0};
+    for (auto elem : Validate::iterator)
+    {
+        EXPECT_EQ(elem.ordinal(), expected++);
+        EXPECT_EQ(Validate::fromValue(elem.value())->ordinal(), elem.ordinal());
+    }
+}
+
+TEST(EnumMapTest, AccessAndIterate)
+{
+    constexpr trlc::EnumMap<Vehicles, int> wheels{{Vehicles::CAR, 4}, {Vehicles::TRUCK, 6}, {Vehicles::MOTORCYCLE, 2}, {Vehicles::BICYCLE, 2}};
+    static_assert(wheels.size() == Vehicles::size());
+    static_assert(wheels[Vehicles::TRUCK] == 6);
+    static_assert(sizeof(wheels) == sizeof(int) * Vehicles::size());
+
+    trlc::EnumMap<CompactStatus, int> counters{};
+    counters[CompactStatus::DONE] += 2;
+    ++counters[CompactStatus::FAILED];
+    EXPECT_EQ(counters[CompactStatus::DONE], 2);
+    EXPECT_EQ(counters[CompactStatus::IDLE], 0);
+
+    std::vector<int64_t> keys{};
+    std::vector<int> values{};
+    for (auto [key, value] : counters)
+    {
+        keys.push_back(key.value());
+        values.push_back(value);
+        ++value;
+    }
+    EXPECT_EQ(keys, (std::vector<int64_t>{-1, 0, 10, 42}));
+    EXPECT_EQ(values, (std::vector<int>{1, 0, 0, 2}));
+    EXPECT_EQ(counters, (trlc::EnumMap<CompactStatus, int>{{CompactStatus::FAILED, 2}, {CompactStatus::RUNNING, 1}, {CompactStatus::IDLE, 1}, {CompactStatus::DONE, 3}}));
+    EXPECT_NE(counters, (trlc::EnumMap<CompactStatus, int>{1}));
+}
+
+TEST(EnumSetTest, InsertEraseContains)
+{
+    constexpr trlc::EnumSet<Validate> set{Validate::NON_FIELD, Validate::FULL_FIELD};
+    static_assert(set.contains(Validate::FULL_FIELD));
+    static_assert(!set.contains(Validate::END));
+    static_assert(set.size() == 2);
+    static_assert(sizeof(set) == sizeof(uint64_t));
+    static_assert(trlc::EnumSet<Validate>::all().size() == Validate::size());
+
+    trlc::EnumSet<CompactStatus> flags{};
+    EXPECT_TRUE(flags.empty());
+    flags.insert(CompactStatus::DONE);
+    flags.insert(CompactStatus::DONE);
+    flags.insert(CompactStatus::FAILED);
+    EXPECT_EQ(flags.size(), 2);
+    flags.erase(CompactStatus::DONE);
+    EXPECT_FALSE(flags.contains(CompactStatus::DONE));
+    EXPECT_TRUE(flags.contains(CompactStatus::FAILED));
+    flags.clear();
+    EXPECT_TRUE(flags.empty());
+}
+
+TEST(EnumSetTest, SetOperationsAndIterate)
+{
+    using HeaderSet = trlc::EnumSet<HttpHeaders>;
+    constexpr HeaderSet lhs{HttpHeaders::ACCEPT, HttpHeaders::HOST, HttpHeaders::VIA};
+    constexpr HeaderSet rhs{HttpHeaders::HOST, HttpHeaders::VIA, HttpHeaders::DATE};
+    static_assert((lhs | rhs) == HeaderSet{HttpHeaders::ACCEPT, HttpHeaders::HOST, HttpHeaders::VIA, HttpHeaders::DATE});
+    static_assert((lhs & rhs) == HeaderSet{HttpHeaders::HOST, HttpHeaders::VIA});
+    static_assert((lhs - rhs) == HeaderSet{HttpHeaders::ACCEPT});
+    static_assert((HeaderSet::all() - lhs).size() == HttpHeaders::size() - 3);
+
+    std::vector<int64_t> values{};
+    for (auto elem : (lhs | rhs))
+    {
+        values.push_back(elem.value());
+    }
+    std::vector<int64_t> expected{};
+    for (auto elem : HttpHeaders::iterator)
+    {
+        if (lhs.contains(elem) || rhs.contains(elem))
+        {
+            expected.push_back(elem.value());
+        }
+    }
+    EXPECT_EQ(values, expected);
+    EXPECT_EQ(values.size(), 4);
+    EXPECT_EQ(HeaderSet{}.begin(), HeaderSet{}.end());
+}
+
+TEST(AtomicEnumTest, LoadStoreExchange)
+{
+    static_assert(sizeof(trlc::AtomicEnum<Colors>) == 1);
+    static_assert(trlc::AtomicEnum<Colors>::is_always_lock_free);
+    static_assert(trlc::AtomicEnum<CompactStatus>::is_always_lock_free);
+
+    trlc::AtomicEnum<Colors> color{Colors::GREEN};
+    EXPECT_TRUE(color.is_lock_free());
+    EXPECT_EQ(color.load(), Colors::GREEN);
+    EXPECT_EQ(color.load().name(), "GREEN");
+    color.store(Colors::BLUE, std::memory_order_release);
+    EXPECT_EQ(color.load(std::memory_order_acquire), Colors::BLUE);
+    EXPECT_EQ(color.exchange(Colors::RED), Colors::BLUE);
+    color = Colors::YELLOW;
+    EXPECT_EQ(static_cast<Colors::enum_type>(color), Colors::YELLOW);
+
+    auto expected{Colors::RED};
+    EXPECT_FALSE(color.compare_exchange_strong(expected, Colors::GREEN));
+    EXPECT_EQ(expected, Colors::YELLOW);
+    EXPECT_TRUE(color.compare_exchange_strong(expected, Colors::GREEN));
+    EXPECT_EQ(color.load(), Colors::GREEN);
+    while (!color.compare_exchange_weak(expected, Colors::RED, std::memory_order_acq_rel))
+    {
+    }
+    EXPECT_EQ(color.load().desc(), "");
+}
+
+TEST(AtomicEnumTest, Transition)
+{
+    trlc::AtomicEnum<CompactStatus> state{CompactStatus::IDLE};
+    CompactStatus::enum_type current{};
+    EXPECT_FALSE(state.transition({CompactStatus::RUNNING}, CompactStatus::DONE, current));
+    EXPECT_EQ(current, CompactStatus::IDLE);
+    EXPECT_TRUE(state.transition({CompactStatus::IDLE, CompactStatus::FAILED}, CompactStatus::RUNNING, current));
+    EXPECT_EQ(current, CompactStatus::IDLE);
+    EXPECT_EQ(state.load(), CompactStatus::RUNNING);
+
+    // Only one of the threads moves the state out of RUNNING.
+    std::vector<std::thread> threads{};
+    std::atomic<int> winners{0};
+    for (int index{0}; index < 4; ++index)
+    {
+        threads.emplace_back([&state, &winners]()
+                             {
+                                 if (state.transition({CompactStatus::RUNNING}, CompactStatus::DONE, std::memory_order_acq_rel))
+                                 {
+                                     ++winners;
+                                 } });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(winners.load(), 1);
+    EXPECT_EQ(state.load(), CompactStatus::DONE);
+}
+
+TEST(EnumCounterTest, IncrementAndSnapshot)
+{
+    using Counter = trlc::EnumCounter<HttpHeaders, 4>;
+    static_assert(alignof(Counter::Shard) == trlc::CACHE_LINE_SIZE);
+    static_assert(sizeof(Counter::Shard) % trlc::CACHE_LINE_SIZE == 0);
+
+    auto counter{std::make_unique<Counter>()};
+    std::vector<std::thread> threads{};
+    for (int index{0}; index < 8; ++index)
+    {
+        threads.emplace_back([&counter]()
+                             {
+                                 for (int count{0}; count < 1000; ++count)
+                                 {
+                                     counter->increment(HttpHeaders::HOST);
+                                 }
+                                 counter->increment(HttpHeaders::VIA, 5); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(counter->count(HttpHeaders::HOST), 8000);
+    EXPECT_EQ(counter->count(HttpHeaders::DATE), 0);
+
+    const auto snapshot{counter->snapshot()};
+    EXPECT_EQ(snapshot[HttpHeaders::HOST], 8000);
+    EXPECT_EQ(snapshot[HttpHeaders::VIA], 40);
+    std::uint64_t total{0};
+    for (auto [header, count] : snapshot)
+    {
+        EXPECT_FALSE(header.name().empty());
+        total += count;
+    }
+    EXPECT_EQ(total, 8040);
+
+    counter->reset();
+    EXPECT_EQ(counter->count(HttpHeaders::HOST), 0);
+}
+
+TEST(InstrumentedPolicyTest, HitsMissesAndCycles)
+{
+    using ValuePolicy = Responses::enum_def::value_search_policy;
+    using NamePolicy = Responses::enum_def::name_search_policy;
+    static_assert(Responses::fromValue(404).value() == Responses::NOT_FOUND);
+    static_assert(!Responses::fromString("CREATED").has_value());
+
+    ValuePolicy::reset<Responses>();
+    NamePolicy::reset<Responses>();
+    EXPECT_EQ(Responses::fromValue(200).value(), Responses::OK);
+    EXPECT_FALSE(Responses::fromValue(201).has_value());
+    std::thread worker{[]()
+                       {
+                           EXPECT_EQ(Responses::fromValue(500).value(), Responses::ERROR);
+                           EXPECT_EQ(Responses::fromString("OK").value(), Responses::OK);
+                       }};
+    worker.join();
+
+    const auto values{ValuePolicy::valueStats<Responses>()};
+    EXPECT_EQ(values.hits, 2);
+    EXPECT_EQ(values.misses, 1);
+    std::uint64_t measured{0};
+    for (auto count : values.cycles)
+    {
+        measured += count;
+    }
+    EXPECT_EQ(measured, values.lookups());
+
+    const auto names{NamePolicy::nameStats<Responses>()};
+    EXPECT_EQ(names.hits, 1);
+    EXPECT_EQ(names.misses, 0);
+    EXPECT_EQ(names.cycles[0] + names.cycles[1], 0);
+    EXPECT_EQ(NamePolicy::valueStats<Responses>().lookups(), 0);
+
+    ValuePolicy::reset<Responses>();
+    EXPECT_EQ(ValuePolicy::valueStats<Responses>().lookups(), 0);
+}
+
+TEST(CaptureUnknownPolicyTest, CaptureDedupAndDrain)
+{
+    static_assert(!Commands::fromValue(7).has_value());
+    static_assert(trlc::handles_unknown_input<Commands::enum_def::unknown_policy, Commands, int64_t>::value);
+    static_assert(!trlc::handles_unknown_input<trlc::policy::UnknownPolicy, Commands, int64_t>::value);
+
+    auto& captured{Commands::enum_def::unknown_policy::captured<Commands>()};
+    EXPECT_FALSE(Commands::fromValue(7).has_value());
+    EXPECT_FALSE(Commands::fromValue(7).has_value());
+    EXPECT_TRUE(Commands::fromValue(0).has_value());
+    EXPECT_FALSE(Commands::fromString("JUMP").has_value());
+    EXPECT_FALSE(Commands::fromString("AN_UNKNOWN_OPCODE_LONGER_THAN_32_CHARACTERS").has_value());
+    EXPECT_FALSE(Commands::fromValue(-3).has_value());
+
+    std::vector<std::string> inputs{};
+    const auto drained{captured.drain([&inputs](const auto& input)
+                                      { inputs.push_back(input.isName() ? std::string{input.name()} + (input.truncated() ? "..." : "") : std::to_string(input.value())); })};
+    EXPECT_EQ(drained, 4);
+    EXPECT_EQ(inputs, (std::vector<std::string>{"7", "JUMP", "AN_UNKNOWN_OPCODE_LONGER_THAN_32...", "-3"}));
+    EXPECT_EQ(captured.drain([](const auto&) {}), 0);
+    EXPECT_EQ(captured.dropped(), 0);
+
+    // Seen inputs are not captured again, the ring keeps at most 4 inputs.
+    EXPECT_FALSE(Commands::fromValue(7).has_value());
+    for (int64_t value{100}; value < 106; ++value)
+    {
+        EXPECT_FALSE(Commands::fromValue(value).has_value());
+    }
+    EXPECT_EQ(captured.drain([](const auto&) {}), 4);
+    EXPECT_EQ(captured.dropped(), 2);
+
+    // The inputs dropped by the full ring are captured again once it is drained.
+    for (int64_t value{100}; value < 106; ++value)
+    {
+        EXPECT_FALSE(Commands::fromValue(value).has_value());
+    }
+    std::vector<int64_t> values{};
+    EXPECT_EQ(captured.drain([&values](const auto& input)
+                             { values.push_back(input.value()); }),
+              2);
+    EXPECT_EQ(values, (std::vector<int64_t>{104, 105}));
+    EXPECT_EQ(captured.dropped(), 2);
+
+    captured.forget();
+    EXPECT_FALSE(Commands::fromValue(7).has_value());
+    EXPECT_EQ(captured.drain([](const auto& input)
+                             { EXPECT_EQ(input.value(), 7); }),
+              1);
+}
+
+TEST(CaptureUnknownPolicyTest, ConcurrentCapture)
+{
+    trlc::UnknownInputCapture<int64_t, 64, 256> capture{};
+    std::vector<std::thread> threads{};
+    for (int64_t thread_index{0}; thread_index < 4; ++thread_index)
+    {
+        threads.emplace_back([&capture, thread_index]()
+                             {
+                                 for (int64_t value{0}; value < 32; ++value)
+                                 {
+                                     capture.capture(value % 16 + 16 * (thread_index % 2));
+                                 } });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::vector<int64_t> values{};
+    EXPECT_EQ(capture.drain([&values](const auto& input)
+                            { values.push_back(input.value()); }),
+              32);
+    std::sort(values.begin(), values.end());
+    for (int64_t value{0}; value < 32; ++value)
+    {
+        EXPECT_EQ(values[value], value);
+    }
+    EXPECT_EQ(capture.dropped(), 0);
+}
+
+TEST(DefaultOnUnknownPolicyTest, UnknownField)
+{
+    using trlc::enum_feild::trlc_field_unknown;
+    static_assert(trlc_field_unknown(R"(A = NormalizeHelper() ("value = 3__delim__unknown = true") * size_t)"));
+    static_assert(trlc_field_unknown(R"(A = NormalizeHelper() ("unknown=true") * size_t)"));
+    static_assert(!trlc_field_unknown(R"(A = NormalizeHelper() ("unknown = false") * size_t)"));
+    static_assert(!trlc_field_unknown(R"(A = NormalizeHelper() ("desc = \"unknown = true\"") * size_t)"));
+    static_assert(!trlc_field_unknown("A"));
+
+    static_assert(trlc::unknown_ordinal<Replies> == 2);
+    static_assert(trlc::unknown_ordinal<Vehicles> == Vehicles::CAR.ordinal());
+    static_assert(trlc::unknown_ordinal<Validate> == Validate::NON_FIELD.ordinal());
+}
+
+TEST(DefaultOnUnknownPolicyTest, Lookup)
+{
+    static_assert(Replies::fromValue(2).value() == Replies::REJECTED);
+    static_assert(Replies::fromValue(3).value() == Replies::UNRECOGNIZED);
+    static_assert(Replies::fromString("MAYBE").value() == Replies::UNRECOGNIZED);
+    static_assert(Replies::REJECTED.desc() == "Not an unknown reply.");
+
+    EXPECT_EQ(Replies::fromValue(-7).value(), Replies::UNRECOGNIZED);
+    EXPECT_EQ(Replies::fromString("ACCEPTED").value(), Replies::ACCEPTED);
+}
+
+TEST(DefaultOnUnknownPolicyTest, FromValueOrAndFromStringOr)
+{
+    static_assert(Replies::fromValueOr(1) == Replies::ACCEPTED);
+    static_assert(Replies::fromValueOr(5) == Replies::UNRECOGNIZED);
+    static_assert(Replies::fromStringOr("REJECTED") == Replies::REJECTED);
+    static_assert(Replies::fromStringOr("rejected") == Replies::UNRECOGNIZED);
+
+    EXPECT_EQ(Colors::fromValueOr(2), Colors::BLUE);
+    EXPECT_EQ(Colors::fromValueOr(42), Colors::RED);
+    EXPECT_EQ(Colors::fromValueOr(42, Colors::YELLOW), Colors::YELLOW);
+    EXPECT_EQ(Colors::fromStringOr("GREEN", Colors::YELLOW), Colors::GREEN);
+    EXPECT_EQ(Colors::fromStringOr("PURPLE", Colors::YELLOW), Colors::YELLOW);
+    EXPECT_EQ(CompactStatus::fromValueOr(7, CompactStatus::FAILED), CompactStatus::FAILED);
+
+    // fromValueOr does not go through the unknown policy.
+    auto& captured{Commands::enum_def::unknown_policy::captured<Commands>()};
+    captured.drain([](const auto&) {});
+    EXPECT_EQ(Commands::fromValueOr(12345), Commands::NOP);
+    EXPECT_EQ(captured.drain([](const auto&) {}), 0);
+}
+
+TEST(DefaultOnUnknownPolicyTest, FromCharsMiss)
+{
+    constexpr std::string_view buffer{"zzz REJECTED"};
+    constexpr auto miss{Replies::fromChars(buffer.data(), buffer.data() + buffer.size())};
+    static_assert(!miss.value.has_value());
+    static_assert(miss.ptr == buffer.data());
+
+    const auto hit{Replies::fromChars(buffer.data() + 4, buffer.data() + buffer.size())};
+    ASSERT_TRUE(hit.value.has_value());
+    EXPECT_EQ(*hit.value, Replies::REJECTED);
+    EXPECT_EQ(hit.ptr, buffer.data() + buffer.size());
+}
+
+TEST(EnumDumpToTest, CharRange)
+{
+    constexpr auto expected{R"({"tag": "WideValues, "value": 9000000000000000000, "name": "LARGEST", "desc": "Above the int32 range."})"};
+    static_assert(WideValues::LARGEST.dumpSize() == std::string_view{expected}.size());
+
+    char buffer[128]{};
+    auto [ptr, ec] = WideValues::LARGEST.dumpTo(std::begin(buffer), std::end(buffer));
+    EXPECT_EQ(ec, std::errc{});
+    EXPECT_EQ((std::string_view{buffer, static_cast<size_t>(ptr - buffer)}), expected);
+    EXPECT_EQ(WideValues::LARGEST.dump(), expected);
+    EXPECT_EQ(WideValues::SMALLEST.dump(), R"({"tag": "WideValues, "value": -5000000000, "name": "SMALLEST", "desc": "Below the int32 range."})");
+
+    auto small{WideValues::LARGEST.dumpTo(buffer, buffer + WideValues::LARGEST.dumpSize() - 1)};
+    EXPECT_EQ(small.ec, std::errc::value_too_large);
+    EXPECT_EQ(small.ptr, buffer + WideValues::LARGEST.dumpSize() - 1);
+}
+
+TEST(EnumDumpToTest, HolderAndOutputIterator)
+{
+    constexpr auto dumped{[]()
+                          {
+                              std::array<char, Vehicles::dumpSize()> result{};
+                              Vehicles::dumpTo(result.data());
+                              return result;
+                          }()};
+    const std::string_view view{dumped.data(), dumped.size()};
+    EXPECT_EQ(view.substr(0, 2), "[\n");
+    EXPECT_EQ(view.substr(view.size() - 3), ",\n]");
+    EXPECT_NE(view.find(Vehicles::BICYCLE.dump()), std::string_view::npos);
+
+    std::string out{};
+    Vehicles::dumpTo(std::back_inserter(out));
+    EXPECT_EQ(out, view);
+    EXPECT_EQ(Vehicles::dump(), view);
+
+    std::string compact{};
+    CompactStatus::FAILED.dumpTo(std::back_inserter(compact));
+    EXPECT_EQ(compact, CompactStatus::FAILED.dump());
+    EXPECT_EQ(compact.size(), CompactStatus::FAILED.dumpSize());
+
+    char buffer[8]{};
+    EXPECT_EQ(Vehicles::dumpTo(std::begin(buffer), std::end(buffer)).ec, std::errc::value_too_large);
+}
+
+TEST(EnumDumpToTest, CompileTimeDump)
+{
+    static_assert(Vehicles::TRUCK.dump() == R"({"tag": "Vehicles, "value": 2, "name": "TRUCK", "desc": "A motor vehicle designed to transport cargo."})");
+    static_assert(CompactStatus::IDLE.dump() == R"({"tag": "CompactStatus, "value": 10, "name": "IDLE", "desc": "Nothing to do."})");
+    static_assert(Colors::dump().size() == Colors::dumpSize());
+
+    for (auto elem : Validate::iterator)
+    {
+        std::string expected{};
+        elem.dumpTo(std::back_inserter(expected));
+        EXPECT_EQ(elem.dump(), expected);
+        EXPECT_NE(Validate::dump().find(" " + expected + ",\n"), std::string_view::npos);
+    }
+}
+
+TEST(EnumDumpToTest, CustomNameAndDesc)
+{
+    constexpr Vehicles::enum_type copy{Vehicles::TRUCK.value(), "TRUCK", "A motor vehicle designed to transport cargo."};
+    static_assert(copy.dump().data() == Vehicles::TRUCK.dump().data());
+
+    const Vehicles::enum_type custom{Vehicles::TRUCK.value(), "CUSTOM", "mine"};
+    EXPECT_EQ(custom.dumpString(), R"({"tag": "Vehicles, "value": 2, "name": "CUSTOM", "desc": "mine"})");
+    EXPECT_THROW(custom.dump(), std::invalid_argument);
+    EXPECT_EQ(Vehicles::TRUCK.dumpString(), Vehicles::TRUCK.dump());
+
+    const Vehicles::enum_type longer{Vehicles::BICYCLE.value(), "A_NAME_LONGER_THAN_ANY_OTHER", std::string_view{Vehicles::dump()}};
+    std::string expected{};
+    longer.dumpTo(std::back_inserter(expected));
+    EXPECT_EQ(longer.dumpString(), expected);
+
+    const Vehicles::enum_type unknown{1000, "UNKNOWN", ""};
+    EXPECT_EQ(unknown.dumpString(), R"({"tag": "Vehicles, "value": 1000, "name": "UNKNOWN", "desc": ""})");
+    EXPECT_THROW(unknown.dump(), std::invalid_argument);
+}
+
+template<class Holder>
+void expectFromValues(const std::vector<typename Holder::value_type>& values, size_t expected_invalid)
+{
+    std::vector<typename Holder::enum_type> out(values.size());
+    EXPECT_EQ(Holder::fromValues(values.data(), values.size(), out.data()), expected_invalid);
+    for (size_t index{0}; index < expected_invalid; ++index)
+    {
+        EXPECT_EQ(out[index], Holder::fromValue(values[index]).value());
+    }
+}
+
+template<class Holder>
+std::vector<typename Holder::value_type> repeatValues(size_t count)
+{
+    std::vector<typename Holder::value_type> result{};
+    for (size_t index{0}; index < count; ++index)
+    {
+        result.push_back(Holder::m_array[(index * 7) % Holder::size()].value());
+    }
+    return result;
+}
+
+TEST(FromValuesTest, DenseContiguous)
+{
+    auto values{repeatValues<Colors>(3000)};
+    expectFromValues<Colors>(values, values.size());
+    expectFromValues<Colors>({}, 0);
+
+    values[2500] = 4;
+    expectFromValues<Colors>(values, 2500);
+    values[1025] = -1;
+    expectFromValues<Colors>(values, 1025);
+}
+
+TEST(FromValuesTest, DenseWithHoles)
+{
+    auto values{repeatValues<Opcodes>(2049)};
+    expectFromValues<Opcodes>(values, values.size());
+
+    values[2048] = 5;
+    expectFromValues<Opcodes>(values, 2048);
+    values[3] = -1;
+    expectFromValues<Opcodes>(values, 3);
+}
+
+TEST(FromValuesTest, Sparse)
+{
+    auto values{repeatValues<SparseOpcodes>(100)};
+    expectFromValues<SparseOpcodes>(values, values.size());
+
+    values[99] = 999;
+    expectFromValues<SparseOpcodes>(values, 99);
+    values[0] = std::numeric_limits<int64_t>::min();
+    expectFromValues<SparseOpcodes>(values, 0);
+}
+
+TEST(FromValuesTest, Int32Values)
+{
+    auto values{repeatValues<LogLevels>(1000)};
+    expectFromValues<LogLevels>(values, values.size());
+
+    values[13] = std::numeric_limits<int32_t>::max();
+    expectFromValues<LogLevels>(values, 13);
+    values[6] = -2;
+    expectFromValues<LogLevels>(values, 6);
+}
+
+TEST(FromStringsTest, ErrorBitmap)
+{
+    const std::vector<std::string_view> names{"CAR", "BOAT", "BICYCLE", "car", "TRUCK"};
+    std::vector<Vehicles::enum_type> out(names.size());
+    uint64_t errors{};
+    EXPECT_EQ(Vehicles::fromStrings(names.data(), names.size(), out.data(), &errors), 2);
+    EXPECT_EQ(errors, 0b01010);
+    EXPECT_EQ(out[0], Vehicles::CAR);
+    EXPECT_EQ(out[2], Vehicles::BICYCLE);
+    EXPECT_EQ(out[4], Vehicles::TRUCK);
+}
+
+TEST(FromStringsTest, Threads)
+{
+    std::vector<std::string> storage{};
+    for (size_t index{0}; index < 20000; ++index)
+    {
+        storage.emplace_back(index % 97 == 0 ? std::string{"UNKNOWN"} : std::string{HttpHeaders::m_array[index % HttpHeaders::size()].name()});
+    }
+    const std::vector<std::string_view> names(storage.begin(), storage.end());
+
+    for (size_t thread_count : {1, 3, 8})
+    {
+        std::vector<HttpHeaders::enum_type> out(names.size());
+        std::vector<uint64_t> errors((names.size() + 63) / 64, ~uint64_t{0});
+        EXPECT_EQ(HttpHeaders::fromStrings(names.data(), names.size(), out.data(), errors.data(), thread_count), (names.size() + 96) / 97);
+        for (size_t index{0}; index < names.size(); ++index)
+        {
+            const bool failed{((errors[index / 64] >> (index % 64)) & 1) != 0};
+            ASSERT_EQ(failed, index % 97 == 0) << index;
+            if (!failed)
+            {
+                ASSERT_EQ(out[index], HttpHeaders::m_array[index % HttpHeaders::size()]) << index;
+            }
+        }
+    }
+}
+
+TEST(FromCharsTest, LongestMatch)
+{
+    constexpr std::string_view request{"IF_MODIFIED_SINCE: today\r\nIF_MATCH"};
+    constexpr auto header{HttpHeaders::fromChars(request.data(), request.data() + request.size())};
+    static_assert(header.value.value() == HttpHeaders::IF_MODIFIED_SINCE);
+    static_assert(header.ptr == request.data() + std::string_view{"IF_MODIFIED_SINCE"}.size());
+
+    // ACCEPT is a prefix of ACCEPT_CHARSET and ACCEPT_ENCODING
+    const std::string buffer{"ACCEPT_ENCODINGS ACCEPT_ ACCEPT"};
+    const char* first{buffer.data()};
+    const char* last{buffer.data() + buffer.size()};
+    auto result{HttpHeaders::fromChars(first, last)};
+    EXPECT_EQ(result.value.value(), HttpHeaders::ACCEPT_ENCODING);
+    EXPECT_EQ(*result.ptr, 'S');
+
+    result = HttpHeaders::fromChars(result.ptr + 2, last);
+    EXPECT_EQ(result.value.value(), HttpHeaders::ACCEPT);
+    EXPECT_EQ(*result.ptr, '_');
+
+    result = HttpHeaders::fromChars(last - 6, last);
+    EXPECT_EQ(result.value.value(), HttpHeaders::ACCEPT);
+    EXPECT_EQ(result.ptr, last);
+
+    // Truncated buffers only match complete names
+    result = HttpHeaders::fromChars(first, first + 5);
+    EXPECT_FALSE(result.value.has_value());
+    EXPECT_EQ(result.ptr, first);
+}
+
+TEST(FromCharsTest, NoMatch)
+{
+    const std::string buffer{"BOAT CAR"};
+    const auto result{Vehicles::fromChars(buffer.data(), buffer.data() + buffer.size())};
+    EXPECT_FALSE(result.value.has_value());
+    EXPECT_EQ(result.ptr, buffer.data());
+    EXPECT_FALSE(Vehicles::fromChars(buffer.data(), buffer.data()).value.has_value());
+    EXPECT_EQ(Vehicles::fromChars(buffer.data() + 5, buffer.data() + buffer.size()).value.value(), Vehicles::CAR);
+}
+
+TEST(ConstexprUtilsTest, TrieRejectsDuplicateKeys)
+{
+    using trlc::constexpr_utils::create_trie;
+    EXPECT_THROW((create_trie<8>(std::array<std::string_view, 2>{"AB", "AB"})), std::invalid_argument);
+    EXPECT_THROW((create_trie<8>(std::array<std::string_view, 2>{"AB", ""})), std::invalid_argument);
+    static_assert(create_trie<6>(std::array<std::string_view, 2>{"AB", "ABC"}).size == 4);
+}
+
+TEST(FromCharsTest, MatchesLongestPrefix)
+{
+    std::vector<std::string> inputs{"", "_", "A", "ACC", "ACCEPT_", "CONTENT_", "CONTENT_TYPES", "IF_", "IF_NONE", "TE", "TEA", "TRAILERS"};
+    for (auto elem : HttpHeaders::iterator)
+    {
+        const std::string name{elem.name()};
+        for (size_t size{0}; size <= name.size(); ++size)
+        {
+            inputs.push_back(name.substr(0, size));
+            inputs.push_back(name.substr(0, size) + "X");
+        }
+        inputs.push_back(name + "_ACCEPT");
+    }
+
+    for (const auto& input : inputs)
+    {
+        std::optional<HttpHeaders::enum_type> expected{};
+        for (auto elem : HttpHeaders::iterator)
+        {
+            if (input.compare(0, elem.name().size(), elem.name()) == 0 && (!expected || elem.name().size() > expected->name().size()))
+            {
+                expected = elem;
+            }
+        }
+        const auto result{HttpHeaders::fromChars(input.data(), input.data() + input.size())};
+        ASSERT_EQ(result.value, expected) << input;
+        ASSERT_EQ(result.ptr, input.data() + (expected ? expected->name().size() : 0)) << input;
+    }
+}
+
+TEST(LengthBucketedStringSearchPolicyTest, ValidStrings)
+{
+    static_assert(HttpMethods::fromString("PUT").value() == HttpMethods::PUT);
+    static_assert(HttpMethods::fromString("UNSUBSCRIBE_ALL_LISTENERS").value() == HttpMethods::UNSUBSCRIBE_ALL_LISTENERS);
+
+    for (auto elem : HttpMethods::iterator)
+    {
+        EXPECT_EQ(HttpMethods::fromString(elem.name()).value(), elem);
+    }
+    EXPECT_EQ(HttpMethods::fromString("CONNECT_PROXY_B").value(), HttpMethods::CONNECT_PROXY_B);
+}
+
+TEST(LengthBucketedStringSearchPolicyTest, InvalidStrings)
+{
+    static_assert(!HttpMethods::fromString("").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("PAT").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("get").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("PROPPATCX").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("CONNECT_PROXY_C").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("PATCH").has_value());
+    EXPECT_FALSE(HttpMethods::fromString("UNSUBSCRIBE_ALL_LISTENERS_").has_value());
+    EXPECT_FALSE(HttpMethods::fromString(std::string_view{"GET\0", 4}).has_value());
+}
+
+TEST(EytzingerSearchPolicyTest, ValidValues)
+{
+    static_assert(ErrorCodes::fromValue(110).value() == ErrorCodes::E_TIMEOUT);
+    static_assert(ErrorCodes::fromValue(-9000000000000000000).value() == ErrorCodes::E_VENDOR_LOW);
+
+    for (auto elem : ErrorCodes::iterator)
+    {
+        EXPECT_EQ(ErrorCodes::fromValue(elem.value()).value(), elem);
+    }
+}
+
+TEST(EytzingerSearchPolicyTest, InvalidValues)
+{
+    static_assert(!ErrorCodes::fromValue(0).has_value());
+    EXPECT_FALSE(ErrorCodes::fromValue(3).has_value());
+    EXPECT_FALSE(ErrorCodes::fromValue(111).has_value());
+    EXPECT_FALSE(ErrorCodes::fromValue(std::numeric_limits<int64_t>::min()).has_value());
+    EXPECT_FALSE(ErrorCodes::fromValue(std::numeric_limits<int64_t>::max()).has_value());
+    for (int64_t value{-1}; value <= 120; ++value)
+    {
+        const auto expected{trlc::policy::BinarySearchPolicy::search<ErrorCodes>(value)};
+        EXPECT_EQ(trlc::policy::EytzingerSearchPolicy::search<ErrorCodes>(value), expected) << value;
+    }
+}
+
+TEST(BinarySearchPolicyTest, BelowSmallestValue)
+{
+    static_assert(!Colors::fromValue(-1).has_value());
+    EXPECT_FALSE(Vehicles::fromValue(0).has_value());
+    EXPECT_FALSE(Validate::fromValue(-101).has_value());
+}
+
+TEST(AutoSearchPolicyTest, SelectedPolicies)
+{
+    static_assert(std::is_same_v<trlc::enum_traits<Signals>::value_search_policy, trlc::policy::LinearSearchPolicy>);
+    static_assert(std::is_same_v<trlc::enum_traits<Signals>::name_search_policy, trlc::policy::CaseSensitiveStringSearchPolicy>);
+    static_assert(std::is_same_v<trlc::enum_traits<Weekdays>::value_search_policy, trlc::policy::DenseTableSearchPolicy>);
+    static_assert(std::is_same_v<trlc::enum_traits<Ports>::value_search_policy, trlc::policy::EytzingerSearchPolicy>);
+    static_assert(std::is_same_v<trlc::enum_traits<Ports>::name_search_policy, trlc::policy::PerfectHashStringSearchPolicy>);
+    static_assert(std::is_same_v<trlc::enum_traits<Colors>::value_search_policy, trlc::policy::BinarySearchPolicy>);
+
+    static_assert(trlc::enum_traits<Weekdays>::min == 0 && trlc::enum_traits<Weekdays>::max == 6);
+    static_assert(trlc::enum_traits<Weekdays>::is_contiguous && trlc::enum_traits<Weekdays>::is_dense);
+    static_assert(trlc::enum_traits<Opcodes>::is_dense && !trlc::enum_traits<Opcodes>::is_contiguous);
+    static_assert(!trlc::enum_traits<Ports>::is_dense && trlc::enum_traits<Ports>::size == 20);
+}
+
+TEST(AutoSearchPolicyTest, Lookup)
+{
+    static_assert(Signals::fromValue(9).value() == Signals::SIGKILL_);
+    static_assert(Weekdays::fromString("FRIDAY").value() == Weekdays::FRIDAY);
+
+    for (auto elem : Signals::iterator)
+    {
+        EXPECT_EQ(Signals::fromValue(elem.value()).value(), elem);
+        EXPECT_EQ(Signals::fromString(elem.name()).value(), elem);
+    }
+    for (auto elem : Weekdays::iterator)
+    {
+        EXPECT_EQ(Weekdays::fromValue(elem.value()).value(), elem);
+    }
+    for (auto elem : Ports::iterator)
+    {
+        EXPECT_EQ(Ports::fromValue(elem.value()).value(), elem);
+        EXPECT_EQ(Ports::fromString(elem.name()).value(), elem);
+    }
+    EXPECT_FALSE(Signals::fromValue(0).has_value());
+    EXPECT_FALSE(Signals::fromValue(35).has_value());
+    EXPECT_FALSE(Weekdays::fromValue(7).has_value());
+    EXPECT_FALSE(Ports::fromValue(24).has_value());
+    EXPECT_FALSE(Ports::fromString("GOPHER").has_value());
+}
+
+TEST(EnumFieldTest, ImplicitValuesSkipSpecificValues)
+{
+    static_assert(Gaps::SECOND.value() == 0);
+    static_assert(Gaps::THIRD.value() == 2);
+    static_assert(Gaps::FIFTH.value() == 4);
+    EXPECT_EQ(Gaps::fromValue(1).value(), Gaps::FIRST);
+    EXPECT_EQ(Gaps::fromValue(3).value(), Gaps::FOURTH);
+}
+
+TEST(EnumFieldTest, RejectsDuplicateValues)
+{
+    using trlc::enum_feild::Field;
+    EXPECT_THROW((trlc::enum_feild::array_values<Colors>(std::array<Field, 3>{Field{"A", "7"}, Field{"B"}, Field{"C", "7"}})), std::invalid_argument);
+    EXPECT_NO_THROW((trlc::enum_feild::array_values<Colors>(std::array<Field, 3>{Field{"A", "7"}, Field{"B"}, Field{"C", "8"}})));
+}
+
+TEST(ConstexprUtilsTest, SortAndUniqueElements)
+{
+    constexpr auto sorted = []()
+    {
+        std::array<int, 9> values{5, -3, 9, 0, 5, 12, -7, 1, 2};
+        trlc::constexpr_utils::sort(values.begin(), values.end());
+        return values;
+    }();
+    constexpr std::array<int, 9> expected{-7, -3, 0, 1, 2, 5, 5, 9, 12};
+    for (std::size_t index{0}; index < sorted.size(); ++index)
+    {
+        EXPECT_EQ(sorted[index], expected[index]);
+    }
+    static_assert(trlc::constexpr_utils::has_unique_elements(std::array<int, 4>{3, 1, 2, 0}));
+    static_assert(!trlc::constexpr_utils::has_unique_elements(std::array<int, 4>{3, 1, 2, 1}));
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);